@@ -24,6 +24,9 @@
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <vector>
 #include <numeric>
+#include <atomic>
+#include <new>
+#include <cstdlib>
 #include <sql.h>
 #include <sqlext.h>
 #include <sqltypes.h>
@@ -35,6 +38,14 @@
 #define SINGLE_ROW 1
 #define ITERATION_COUNT 10
 
+// Driver-specific statement attribute to set the number of result pages
+// fetched ahead of the cursor
+#define SQL_ATTR_SWPREFETCH_PAGES 65537
+
+// Driver-specific statement attribute to set the number of rows of the first
+// result page, which enables adaptive page sizing
+#define SQL_ATTR_SWFIRST_PAGE_SIZE 65540
+
 #ifndef WIN32
 typedef SQLULEN SQLROWCOUNT;
 typedef SQLULEN SQLROWSETSIZE;
@@ -63,9 +74,30 @@ bool queryFinished = false;
 // The number of executed tests
 int testNumber = 0;
 
-// Whether to run Q21_EXPECT_2000000_ROWS, which greatly extends runtime
+// Whether to run Q22_EXPECT_1500000_ROWS and
+// Q23_EXPECT_1000000_DOUBLE_VALUES, which greatly extend runtime
 bool enableLargeTest = false;
 
+// Number of heap allocations made by the process, including the driver where
+// its allocations resolve to the operator new below (Linux and macOS).
+std::atomic< long long > allocationCount(0);
+
+void* operator new(std::size_t size) {
+  allocationCount++;
+  if (void* ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
 void prepareOutFile() {
   std::ofstream outFile(outFileName, std::ios::trunc);
   if (!outFile.is_open()) {
@@ -76,7 +108,8 @@ void prepareOutFile() {
   outFile << "Test Round,test_name,query,loop_count,Average Time (ms),Max Time "
              "(ms),Min Time (ms),"
              "Median Time (ms),90th Percentile (ms),Average Memory Usage "
-             "(KB),Peak Memory Usage (KB)\n";
+             "(KB),Peak Memory Usage (KB),Throughput (rows/s),Allocations Per "
+             "Row,Average Time To First Row (ms)\n";
   outFile.close();
   return;
 }
@@ -104,12 +137,17 @@ void queryMemUsage(long long& averageMem, long long& peakMem) {
 
 auto RecordBindingFetching = [](SQLHSTMT& hstmt,
                                 std::vector< long long >& times,
-                                const testString& query, bool is_wchar) {
+                                const testString& query, bool is_wchar,
+                                long long& fetched_rows,
+                                long long& allocations,
+                                long long& first_row_time) {
   SQLSMALLINT total_columns = 0;
   int row_count = 0;
+  long long first_row_sum = 0;
 
   for (size_t iter = 0; iter < ITERATION_COUNT; iter++) {
     row_count = 0;
+    long long allocationStart = allocationCount.load();
     // Execute query
     auto start = std::chrono::steady_clock::now();
 
@@ -129,8 +167,14 @@ auto RecordBindingFetching = [](SQLHSTMT& hstmt,
         ret = SQLBindCol(hstmt, static_cast< SQLUSMALLINT >(i + 1), SQL_C_WCHAR,
                          static_cast< SQLPOINTER >(&cols[i].data_dat), 255,
                          &cols[i].data_len);
-      while (SQLFetch(hstmt) == SQL_SUCCESS)
-        row_count++;
+      while (SQLFetch(hstmt) == SQL_SUCCESS) {
+        if (row_count++ == 0) {
+          first_row_sum +=
+              std::chrono::duration_cast< std::chrono::milliseconds >(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
+        }
+      }
       auto end = std::chrono::steady_clock::now();
       std::cout << "Total rows: " << row_count << std::endl;
       times.push_back(
@@ -146,8 +190,14 @@ auto RecordBindingFetching = [](SQLHSTMT& hstmt,
         ret = SQLBindCol(hstmt, static_cast< SQLUSMALLINT >(i + 1), SQL_C_CHAR,
                          static_cast< SQLPOINTER >(&cols[i].data_dat), 255,
                          &cols[i].data_len);
-      while (SQLFetch(hstmt) == SQL_SUCCESS)
-        row_count++;
+      while (SQLFetch(hstmt) == SQL_SUCCESS) {
+        if (row_count++ == 0) {
+          first_row_sum +=
+              std::chrono::duration_cast< std::chrono::milliseconds >(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
+        }
+      }
       auto end = std::chrono::steady_clock::now();
       std::cout << "Total rows: " << row_count << std::endl;
       times.push_back(
@@ -156,34 +206,66 @@ auto RecordBindingFetching = [](SQLHSTMT& hstmt,
       logDiagnostics(SQL_HANDLE_STMT, hstmt, ret);
       SQLCloseCursor(hstmt);
     }
+    fetched_rows = row_count;
+    allocations = allocationCount.load() - allocationStart;
   }
+  first_row_time = first_row_sum / ITERATION_COUNT;
   queryFinished = true;
 };
 
-// Test template for Amazon queries
-#define TEST_PERF_TEST(test_name, query, is_wchar)                           \
+// Check if the current test is one of the tests enabled by --large-test
+bool IsLargeTest() {
+  const char* name =
+      ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  return strcmp(name, "Q22_EXPECT_1500000_ROWS") == 0
+         || strcmp(name, "Q23_EXPECT_1000000_DOUBLE_VALUES") == 0;
+}
+
+// Test template for Amazon queries with the given driver-specific statement
+// attribute value. A value of 0 keeps the connection setting.
+#define TEST_PERF_STMT_ATTR_TEST(test_name, query, is_wchar, attr, value)    \
   TEST_F(TestPerformance, test_name) {                                       \
-    if (strcmp(                                                              \
-            ::testing::UnitTest::GetInstance()->current_test_info()->name(), \
-            "Q22_EXPECT_1500000_ROWS")                                       \
-            == 0                                                             \
-        && !enableLargeTest) {                                               \
+    if (IsLargeTest() && !enableLargeTest) {                                 \
       GTEST_SKIP();                                                          \
     }                                                                        \
+    if (value > 0) {                                                         \
+      SQLRETURN ret = SQLSetStmtAttr(_hstmt, attr, (SQLPOINTER)value, 0);    \
+      ASSERT_TRUE(SQL_SUCCEEDED(ret));                                       \
+    }                                                                        \
     std::vector< long long > times;                                          \
     int currentMem = currentMemUsage();                                      \
     long long averageMem = 0;                                                \
     long long peakMem = 0;                                                   \
+    long long fetchedRows = 0;                                               \
+    long long allocations = 0;                                               \
+    long long firstRowTime = 0;                                              \
     boost::thread queryThread([&] {                                          \
-      RecordBindingFetching(_hstmt, times, testString(query), is_wchar);     \
+      RecordBindingFetching(_hstmt, times, testString(query), is_wchar,      \
+                            fetchedRows, allocations, firstRowTime);         \
     });                                                                      \
     boost::thread memThread([&] { queryMemUsage(averageMem, peakMem); });    \
     queryThread.join();                                                      \
     memThread.join();                                                        \
     queryFinished = false;                                                   \
-    Report(#test_name, times, testString(query), averageMem, peakMem);       \
+    Report(#test_name, times, testString(query), averageMem, peakMem,        \
+           fetchedRows, allocations, firstRowTime);                          \
   }
 
+// Test template for Amazon queries with the given prefetch depth
+#define TEST_PERF_PREFETCH_TEST(test_name, query, is_wchar, prefetch_pages) \
+  TEST_PERF_STMT_ATTR_TEST(test_name, query, is_wchar,                      \
+                           SQL_ATTR_SWPREFETCH_PAGES, prefetch_pages)
+
+// Test template for Amazon queries with adaptive page sizing starting with
+// the given first page size
+#define TEST_PERF_FIRST_PAGE_TEST(test_name, query, is_wchar, first_page_size) \
+  TEST_PERF_STMT_ATTR_TEST(test_name, query, is_wchar,                         \
+                           SQL_ATTR_SWFIRST_PAGE_SIZE, first_page_size)
+
+// Test template for Amazon queries
+#define TEST_PERF_TEST(test_name, query, is_wchar) \
+  TEST_PERF_PREFETCH_TEST(test_name, query, is_wchar, 0)
+
 class TestPerformance : public testing::Test {
  public:
   SQLHENV _env = SQL_NULL_HENV;
@@ -251,11 +333,15 @@ const std::string sync_median = "%%__MEDIAN__%%";
 const std::string sync_percentile = "%%__90TH_PERCENTILE__%%";
 const std::string sync_average_memory_usage = "%%__AVERAGE_MEMORY_USAGE__%%";
 const std::string sync_peak_memory_usage = "%%__PEAK_MEMORY_USAGE__%%";
+const std::string sync_throughput = "%%__THROUGHPUT__%%";
+const std::string sync_allocations = "%%__ALLOCATIONS_PER_ROW__%%";
+const std::string sync_first_row = "%%__TIME_TO_FIRST_ROW__%%";
 const std::string sync_end = "%%__PARSE__SYNC__END__%%";
 
 void Report(const std::string& test_case, std::vector< long long > data,
             const testString& query, long long averageMemoryUsage,
-            long long peakMemoryUsage) {
+            long long peakMemoryUsage, long long fetchedRows = 0,
+            long long allocations = 0, long long firstRowTime = 0) {
   size_t size = data.size();
   ASSERT_EQ(size, (size_t)ITERATION_COUNT);
 
@@ -281,6 +367,18 @@ void Report(const std::string& test_case, std::vector< long long > data,
     percentile = data[ordinalRank - 1];
   }
 
+  // Get fetch throughput based on the mean time of one iteration
+  long long throughput = 0;
+  if (time_mean > 0) {
+    throughput = fetchedRows * 1000 / time_mean;
+  }
+
+  // Get heap allocations per fetched row of the last iteration
+  double allocationsPerRow = 0;
+  if (fetchedRows > 0) {
+    allocationsPerRow = static_cast< double >(allocations) / fetchedRows;
+  }
+
   // Output results
   std::cout << sync_start << std::endl;
   std::cout << sync_query;
@@ -294,6 +392,9 @@ void Report(const std::string& test_case, std::vector< long long > data,
   std::cout << sync_average_memory_usage << averageMemoryUsage << " KB"
             << std::endl;
   std::cout << sync_peak_memory_usage << peakMemoryUsage << " KB" << std::endl;
+  std::cout << sync_throughput << throughput << " rows/s" << std::endl;
+  std::cout << sync_allocations << allocationsPerRow << std::endl;
+  std::cout << sync_first_row << firstRowTime << " ms" << std::endl;
   std::cout << sync_end << std::endl;
 
   std::cout << "Time dump: ";
@@ -317,7 +418,8 @@ void Report(const std::string& test_case, std::vector< long long > data,
           << std::to_string(ITERATION_COUNT) << "," << time_mean << ","
           << time_max << "," << time_min << "," << time_median << ","
           << percentile << "," << averageMemoryUsage << "," << peakMemoryUsage
-          << "\n";
+          << "," << throughput << "," << allocationsPerRow << ","
+          << firstRowTime << "\n";
   outFile.close();
 }
 
@@ -1028,11 +1130,38 @@ TEST_PERF_TEST(
     CREATE_STRING("SELECT * FROM perfdb_hcltps.perftable_hcltps LIMIT 15000"),
     true)
 
+// Compare fetch throughput of a multi-page result set with different
+// prefetch depths
+TEST_PERF_PREFETCH_TEST(
+    Q21_EXPECT_15000_ROWS_PREFETCH_1_PAGE,
+    CREATE_STRING("SELECT * FROM perfdb_hcltps.perftable_hcltps LIMIT 15000"),
+    true, 1)
+
+TEST_PERF_PREFETCH_TEST(
+    Q21_EXPECT_15000_ROWS_PREFETCH_8_PAGES,
+    CREATE_STRING("SELECT * FROM perfdb_hcltps.perftable_hcltps LIMIT 15000"),
+    true, 8)
+
+// Compare time to first row and fetch throughput of fixed and adaptive page
+// sizing
+TEST_PERF_FIRST_PAGE_TEST(
+    Q21_EXPECT_15000_ROWS_FIRST_PAGE_100_ROWS,
+    CREATE_STRING("SELECT * FROM perfdb_hcltps.perftable_hcltps LIMIT 15000"),
+    true, 100)
+
 TEST_PERF_TEST(
     Q22_EXPECT_1500000_ROWS,
     CREATE_STRING("SELECT * FROM perfdb_hcltps.perftable_hcltps LIMIT 1500000"),
     true)
 
+// Measure the conversion of a million-value DOUBLE column
+TEST_PERF_TEST(
+    Q23_EXPECT_1000000_DOUBLE_VALUES,
+    CREATE_STRING("SELECT measure_value::double FROM "
+                  "perfdb_hcltps.perftable_hcltps WHERE measure_value::double "
+                  "IS NOT NULL LIMIT 1000000"),
+    true)
+
 int main(int argc, char** argv) {
 #ifdef WIN32
   // Enable CRT for detecting memory leaks
@@ -1068,8 +1197,9 @@ int main(int argc, char** argv) {
         std::cout
             << "Invalid argument: " << std::string(argv[i]) << std::endl
             << "Valid arguments are:\n"
-               "--large-test\t\t\t\t\t\t\tEnable the test that returns "
-               "1,500,000 rows and extends the run time to ~11 hours.\n"
+               "--large-test\t\t\t\t\t\t\tEnable the tests that return "
+               "1,000,000 rows or more and extend the run time by many "
+               "hours.\n"
                "--region <region>\t\t\t\t\t\tThe region to use for testing. "
                "Optional, but if provided then the access key ID and secret "
                "key must also be provided. Defaults to us-east-1.\n"
@@ -0,0 +1,92 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _IOTSITEWISE_ODBC_ADAPTIVE_PAGE_SIZE
+#define _IOTSITEWISE_ODBC_ADAPTIVE_PAGE_SIZE
+
+#include <stdint.h>
+
+#include <cstddef>
+
+#include "ignite/common/common.h"
+
+/** Largest page size requested when MaxRowPerPage is not set. */
+#define ADAPTIVE_PAGE_SIZE_LIMIT 20000
+
+/** Page latency in milliseconds the page size is tuned for. */
+#define ADAPTIVE_PAGE_TARGET_LATENCY 1000
+
+namespace iotsitewise {
+namespace odbc {
+/**
+ * Page size of the requests of one query execution. It starts small for a
+ * fast first row and grows while the pages come back quickly, but never
+ * beyond what the memory budget allows for the pages held at once.
+ */
+class IGNITE_IMPORT_EXPORT AdaptivePageSize {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param firstPageSize Rows of the first page.
+   * @param maxPageSize Max rows of a page, 0 or negative means
+   * ADAPTIVE_PAGE_SIZE_LIMIT.
+   * @param memoryBudget Bytes the pages held at once may take.
+   * @param pages Max number of pages held at once.
+   * @param targetLatency Page latency in milliseconds to tune for.
+   */
+  AdaptivePageSize(int32_t firstPageSize, int32_t maxPageSize,
+                   size_t memoryBudget, size_t pages,
+                   int64_t targetLatency = ADAPTIVE_PAGE_TARGET_LATENCY);
+
+  /**
+   * Get the page size of the next request.
+   *
+   * @return Number of rows to request.
+   */
+  int32_t GetPageSize() const {
+    return pageSize_;
+  }
+
+  /**
+   * Adjust the page size to a received page.
+   *
+   * @param rows Number of rows of the page.
+   * @param bytes Estimated size of the page in bytes.
+   * @param latency Milliseconds the request took.
+   */
+  void Update(size_t rows, size_t bytes, int64_t latency);
+
+ private:
+  /** Page size of the next request. */
+  int32_t pageSize_;
+
+  /** Max page size. */
+  int32_t maxPageSize_;
+
+  /** Bytes one page may take. */
+  size_t pageBudget_;
+
+  /** Page latency in milliseconds to tune for. */
+  int64_t targetLatency_;
+
+  /** Average size of a row in bytes, 0 until a page is received. */
+  size_t rowBytes_;
+};
+}  // namespace odbc
+}  // namespace iotsitewise
+
+#endif  //_IOTSITEWISE_ODBC_ADAPTIVE_PAGE_SIZE
@@ -147,6 +147,16 @@ class ApplicationDataBuffer {
     this->elementOffset = idx;
   }
 
+  /**
+   * Set the row bind type. The elements of the arrays are the fields of
+   * consecutive row structures for row-wise binding.
+   *
+   * @param bindType Size of the row structure, or SQL_BIND_BY_COLUMN.
+   */
+  void SetBindType(SqlUlen bindType) {
+    this->bindType = bindType;
+  }
+
   /**
    * Put in buffer value of type optional int8_t.
    *
@@ -492,6 +502,23 @@ class ApplicationDataBuffer {
    */
   SqlLen GetElementSize() const;
 
+  /**
+   * Get distance in bytes between the consecutive elements of the data
+   * array.
+   *
+   * @return Element size, or the row size for row-wise binding.
+   */
+  SqlLen GetDataStride() const;
+
+  /**
+   * Get distance in bytes between the consecutive elements of the result
+   * length array.
+   *
+   * @return Size of the result length, or the row size for row-wise
+   *     binding.
+   */
+  SqlLen GetResLenStride() const;
+
   /**
    * Get size of the input buffer.
    *
@@ -641,6 +668,9 @@ class ApplicationDataBuffer {
 
   /** Current element offset. */
   SqlUlen elementOffset;
+
+  /** Row bind type, the size of the row structure for row-wise binding. */
+  SqlUlen bindType;
 };
 
 /** Column binging map type alias. */
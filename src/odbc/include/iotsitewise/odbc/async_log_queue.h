@@ -0,0 +1,118 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _IOTSITEWISE_ODBC_ASYNC_LOG_QUEUE
+#define _IOTSITEWISE_ODBC_ASYNC_LOG_QUEUE
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "ignite/common/common.h"
+
+namespace iotsitewise {
+namespace odbc {
+/**
+ * Bounded queue of formatted log messages. Any number of threads could push
+ * messages, a single writer thread pops them.
+ *
+ * The queue is a ring of cells, each cell has a sequence number telling
+ * whether it is free for the producer of a position or filled for the
+ * consumer, so a push is a compare-and-swap on the enqueue position and no
+ * thread waits for a lock. The number of cells is fixed on construction,
+ * which bounds the memory held by pending messages.
+ */
+class IGNITE_IMPORT_EXPORT AsyncLogQueue {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param capacity Maximum number of pending messages. It is rounded up to
+   * a power of two.
+   */
+  explicit AsyncLogQueue(size_t capacity);
+
+  /**
+   * Destructor.
+   */
+  ~AsyncLogQueue() = default;
+
+  /**
+   * Push a message. Could be called by any thread.
+   *
+   * @param message Message. It is moved into the queue on success and left
+   * untouched if the queue is full.
+   * @return @c true if the message is queued, @c false if the queue is full.
+   */
+  bool TryPush(std::string& message);
+
+  /**
+   * Pop the oldest message. Must be called by a single thread.
+   *
+   * @param message Message popped.
+   * @return @c true if a message is popped, @c false if the queue is empty.
+   */
+  bool TryPop(std::string& message);
+
+  /**
+   * Get the maximum number of pending messages.
+   *
+   * @return Capacity.
+   */
+  size_t GetCapacity() const {
+    return mask_ + 1;
+  }
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(AsyncLogQueue);
+
+  /** Size of a cache line, positions are kept on separate lines. */
+  enum { CACHE_LINE_SIZE = 64 };
+
+  /** Cell of the ring. */
+  struct Cell {
+    /** Position the cell is ready for. */
+    std::atomic< size_t > sequence;
+
+    /** Message. */
+    std::string message;
+  };
+
+  /** Cells. */
+  std::unique_ptr< Cell[] > cells_;
+
+  /** Capacity minus one, to get the cell of a position. */
+  const size_t mask_;
+
+  /** Padding. */
+  char pad0_[CACHE_LINE_SIZE];
+
+  /** Position of the next push. */
+  std::atomic< size_t > enqueuePos_;
+
+  /** Padding. */
+  char pad1_[CACHE_LINE_SIZE];
+
+  /** Position of the next pop. */
+  std::atomic< size_t > dequeuePos_;
+
+  /** Padding. */
+  char pad2_[CACHE_LINE_SIZE];
+};
+}  // namespace odbc
+}  // namespace iotsitewise
+
+#endif  //_IOTSITEWISE_ODBC_ASYNC_LOG_QUEUE
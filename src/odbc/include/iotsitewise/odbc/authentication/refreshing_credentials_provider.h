@@ -0,0 +1,146 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+#ifndef _IOTSITEWISE_ODBC_AUTHENTICATION_REFRESHING_CREDENTIALS_PROVIDER
+#define _IOTSITEWISE_ODBC_AUTHENTICATION_REFRESHING_CREDENTIALS_PROVIDER
+
+#include <stdint.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <aws/core/auth/AWSCredentials.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+
+#include "ignite/common/common.h"
+
+namespace iotsitewise {
+namespace odbc {
+/**
+ * Credentials provider of an IoT SiteWise client renewing its credentials
+ * before they expire, so a long-lived connection keeps working past the
+ * lifetime of its STS session.
+ *
+ * The renewal is started by the first request signed within the refresh
+ * window and runs on the thread pool. Until it finishes the requests are
+ * signed with the current credentials, which are still valid, and the new
+ * credentials replace them at once.
+ *
+ * The provider must be owned by a std::shared_ptr, as the renewal keeps it
+ * alive while it runs.
+ */
+class IGNITE_IMPORT_EXPORT RefreshingCredentialsProvider
+    : public Aws::Auth::AWSCredentialsProvider,
+      public std::enable_shared_from_this< RefreshingCredentialsProvider > {
+ public:
+  /** Function fetching new credentials, returning false on failure. */
+  typedef std::function< bool(Aws::Auth::AWSCredentials&, std::string&) >
+      Fetcher;
+
+  /** Default seconds before the expiration the credentials are renewed. */
+  enum { DEFAULT_REFRESH_WINDOW_SECS = 300 };
+
+  /** Seconds before a failed renewal is retried. */
+  enum { RETRY_INTERVAL_SECS = 30 };
+
+  /**
+   * Constructor.
+   *
+   * @param credentials Current credentials.
+   * @param fetcher Function fetching new credentials.
+   * @param refreshWindow Seconds before the expiration the credentials are
+   * renewed.
+   */
+  RefreshingCredentialsProvider(
+      const Aws::Auth::AWSCredentials& credentials, const Fetcher& fetcher,
+      int32_t refreshWindow = DEFAULT_REFRESH_WINDOW_SECS);
+
+  /**
+   * Destructor.
+   */
+  ~RefreshingCredentialsProvider() override = default;
+
+  /**
+   * Get the current credentials, starting a renewal in the background if
+   * they are about to expire. It never waits for the renewal.
+   *
+   * @return Current credentials.
+   */
+  Aws::Auth::AWSCredentials GetAWSCredentials() override;
+
+  /**
+   * Wait for the running renewal to finish.
+   */
+  void WaitForRefresh();
+
+  /**
+   * Wait for the renewals of all providers to finish and release their
+   * providers, so no fetcher outlives the SDK.
+   */
+  static void WaitForRenewals();
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(RefreshingCredentialsProvider);
+
+  /**
+   * Fetch new credentials and replace the current ones. It is executed by
+   * a thread pool worker.
+   */
+  void Refresh();
+
+  /**
+   * Signal a renewal is finished. It is called once the renewal released
+   * its provider.
+   */
+  static void FinishRenewal();
+
+  /** Function fetching new credentials. */
+  const Fetcher fetcher_;
+
+  /** Seconds before the expiration the credentials are renewed. */
+  const int32_t refreshWindow_;
+
+  /** Mutex protecting the credentials. */
+  std::mutex mutex_;
+
+  /** Condition variable signaled when a renewal finishes. */
+  std::condition_variable cv_;
+
+  /** Current credentials. */
+  Aws::Auth::AWSCredentials credentials_;
+
+  /** Flag indicating a renewal is running. */
+  bool isRefreshing_;
+
+  /** Time before which no renewal is started after a failed one. */
+  std::chrono::steady_clock::time_point nextAttempt_;
+
+  /** Mutex protecting the number of running renewals. */
+  static std::mutex renewalsMutex_;
+
+  /** Condition variable signaled when a renewal finishes. */
+  static std::condition_variable renewalsCv_;
+
+  /** Number of renewals queued or running in the thread pool. */
+  static size_t renewals_;
+};
+}  // namespace odbc
+}  // namespace iotsitewise
+
+#endif  //_IOTSITEWISE_ODBC_AUTHENTICATION_REFRESHING_CREDENTIALS_PROVIDER
@@ -0,0 +1,152 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+#ifndef _IOTSITEWISE_ODBC_AUTHENTICATION_SAML_CREDENTIALS_CACHE
+#define _IOTSITEWISE_ODBC_AUTHENTICATION_SAML_CREDENTIALS_CACHE
+
+#include <stdint.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <aws/core/auth/AWSCredentials.h>
+
+#include "ignite/common/common.h"
+#include "iotsitewise/odbc/authentication/saml.h"
+#include "iotsitewise/odbc/config/configuration.h"
+
+namespace iotsitewise {
+namespace odbc {
+/**
+ * Cache of the STS credentials fetched with SAML assertions, shared by all
+ * connections of the process and keyed by the IdP, user and role. A connect
+ * with cached credentials skips the IdP and STS requests.
+ *
+ * Credentials are refreshed by the thread pool when a connect finds them
+ * close to their expiration, so no connect waits for the IdP while they are
+ * still valid. The cache is kept in memory only.
+ */
+class IGNITE_IMPORT_EXPORT SAMLCredentialsCache {
+ public:
+  /** Default seconds before the expiration the credentials are refreshed. */
+  enum { DEFAULT_REFRESH_WINDOW_SECS = 300 };
+
+  /**
+   * Constructor.
+   *
+   * @param refreshWindow Seconds before the expiration the credentials are
+   * refreshed.
+   */
+  explicit SAMLCredentialsCache(
+      int32_t refreshWindow = DEFAULT_REFRESH_WINDOW_SECS);
+
+  /**
+   * Destructor.
+   */
+  ~SAMLCredentialsCache() = default;
+
+  /**
+   * Get the process-wide cache.
+   *
+   * @return Process-wide cache.
+   */
+  static SAMLCredentialsCache& GetInstance();
+
+  /**
+   * Make the key of the credentials of a configuration. The key is a digest
+   * of the IdP settings and secrets, so the secrets are not kept.
+   *
+   * @param config Configuration.
+   * @return Cache key.
+   */
+  static std::string MakeKey(const config::Configuration& config);
+
+  /**
+   * Get the credentials of a key. They are fetched with the provider if
+   * none are cached, or if the cached ones are expired.
+   *
+   * @param key Cache key.
+   * @param provider Provider fetching the credentials. It is kept to
+   * refresh the credentials in the background.
+   * @param credentials Credentials.
+   * @param errInfo Error message when there is a failure.
+   * @return @c true on success and @c false otherwise.
+   */
+  bool GetCredentials(
+      const std::string& key,
+      std::shared_ptr< IoTSiteWiseSAMLCredentialsProvider > provider,
+      Aws::Auth::AWSCredentials& credentials, std::string& errInfo);
+
+  /**
+   * Wait for the background refreshes to finish.
+   */
+  void WaitForRefreshes();
+
+  /**
+   * Drop all cached credentials.
+   */
+  void Clear();
+
+  /**
+   * Get number of cached credentials.
+   *
+   * @return Number of credentials.
+   */
+  size_t GetSize() const;
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(SAMLCredentialsCache);
+
+  /** Cached credentials. */
+  struct Entry {
+    /** Credentials. */
+    Aws::Auth::AWSCredentials credentials;
+
+    /** Flag indicating a background refresh is running. */
+    bool isRefreshing = false;
+  };
+
+  /**
+   * Refresh credentials. It is executed by a thread pool worker.
+   *
+   * @param key Cache key.
+   * @param provider Provider fetching the credentials. It is released before
+   * the refresh is signaled as finished.
+   */
+  void Refresh(const std::string& key,
+               std::shared_ptr< IoTSiteWiseSAMLCredentialsProvider > provider);
+
+  /** Seconds before the expiration the credentials are refreshed. */
+  const int32_t refreshWindow_;
+
+  /** Mutex protecting the entries. */
+  mutable std::mutex mutex_;
+
+  /** Condition variable signaled when a refresh finishes. */
+  std::condition_variable cv_;
+
+  /** Credentials by key. */
+  std::unordered_map< std::string, Entry > entries_;
+
+  /** Number of running background refreshes. */
+  size_t refreshes_;
+};
+}  // namespace odbc
+}  // namespace iotsitewise
+
+#endif  //_IOTSITEWISE_ODBC_AUTHENTICATION_SAML_CREDENTIALS_CACHE
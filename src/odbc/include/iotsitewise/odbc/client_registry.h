@@ -0,0 +1,166 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _IOTSITEWISE_ODBC_CLIENT_REGISTRY
+#define _IOTSITEWISE_ODBC_CLIENT_REGISTRY
+
+#include <stdint.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <aws/core/auth/AWSCredentials.h>
+#include <aws/core/client/ClientConfiguration.h>
+
+#include "ignite/common/common.h"
+#include "iotsitewise/odbc/query_client.h"
+
+namespace iotsitewise {
+namespace odbc {
+/**
+ * Registry of the IoT SiteWise clients shared by all connections of the
+ * process. Connections with the same endpoint, credentials and client
+ * configuration share one client, so they reuse its HTTP connections and
+ * TLS sessions instead of opening new ones on every connect.
+ *
+ * A client is kept for an idle timeout after its last connection releases
+ * it, as applications often close a connection right before opening the
+ * next one.
+ */
+class IGNITE_IMPORT_EXPORT ClientRegistry {
+ public:
+  /** Factory creating a client that is not registered yet. */
+  typedef std::function< std::shared_ptr< QueryClient >() > Factory;
+
+  /** Default seconds an unused client is kept. */
+  enum { DEFAULT_IDLE_TIMEOUT_SECS = 60 };
+
+  /**
+   * Constructor.
+   *
+   * @param idleTimeout Seconds an unused client is kept.
+   */
+  explicit ClientRegistry(int32_t idleTimeout = DEFAULT_IDLE_TIMEOUT_SECS);
+
+  /**
+   * Destructor.
+   */
+  ~ClientRegistry() = default;
+
+  /**
+   * Get the process-wide registry.
+   *
+   * @return Process-wide registry.
+   */
+  static ClientRegistry& GetInstance();
+
+  /**
+   * Make the key of a client. The key is a digest of the settings, so the
+   * secrets are not kept in the registry.
+   *
+   * @param credentials AWS credentials.
+   * @param clientCfg AWS client configuration.
+   * @param endpoint Endpoint override, empty if not set.
+   * @param maxRetryCount Max retry count of the client, the retry strategy
+   * of the client configuration is not compared.
+   * @param rawResponseDecoding Raw response decoding flag of the client.
+   * @return Registry key.
+   */
+  static std::string MakeKey(
+      const Aws::Auth::AWSCredentials& credentials,
+      const Aws::Client::ClientConfiguration& clientCfg,
+      const std::string& endpoint, int32_t maxRetryCount,
+      bool rawResponseDecoding);
+
+  /**
+   * Get the client of a key, creating it if there is none. The client is
+   * released when the returned pointer and all its copies are destroyed.
+   *
+   * @param key Registry key.
+   * @param factory Factory creating the client if there is none.
+   * @return Client.
+   */
+  std::shared_ptr< QueryClient > Acquire(const std::string& key,
+                                         const Factory& factory);
+
+  /**
+   * Remove all clients. The clients still held keep working but are no
+   * longer shared. It is called before the AWS SDK is shut down, so no
+   * unused client outlives it.
+   */
+  void Clear();
+
+  /**
+   * Get number of registered clients, including the unused ones.
+   *
+   * @return Number of clients.
+   */
+  size_t GetSize() const;
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(ClientRegistry);
+
+  /** Clock used for idle expiration. */
+  typedef std::chrono::steady_clock Clock;
+
+  /** Registered client. */
+  struct Entry {
+    /** Client. */
+    std::shared_ptr< QueryClient > client;
+
+    /** Number of holders of the client. */
+    size_t leases;
+
+    /** Time the last holder released the client. */
+    Clock::time_point released;
+  };
+
+  /**
+   * Release a client.
+   *
+   * @param key Registry key.
+   * @param client Released client. It is ignored if the key has another
+   * client since the registry was cleared.
+   */
+  void Release(const std::string& key, const QueryClient* client);
+
+  /**
+   * Remove the clients unused for longer than the idle timeout. It must be
+   * called with the mutex locked.
+   *
+   * @param expired Removed clients. They are destroyed by the caller once
+   * the mutex is unlocked.
+   */
+  void RemoveExpired(std::vector< std::shared_ptr< QueryClient > >& expired);
+
+  /** Seconds an unused client is kept. */
+  const int32_t idleTimeout_;
+
+  /** Mutex protecting the entries. */
+  mutable std::mutex mutex_;
+
+  /** Clients by key. */
+  std::unordered_map< std::string, Entry > entries_;
+};
+}  // namespace odbc
+}  // namespace iotsitewise
+
+#endif  //_IOTSITEWISE_ODBC_CLIENT_REGISTRY
@@ -31,6 +31,7 @@
 #include "iotsitewise/odbc/authentication/auth_type.h"
 #include "ignite/odbc/odbc_error.h"
 #include "iotsitewise/odbc/log_level.h"
+#include "iotsitewise/odbc/validation_mode.h"
 
 #define DEFAULT_DSN "IoT SiteWise DSN"
 #define DEFAULT_DRIVER "AWS IoT SiteWise ODBC Driver"
@@ -62,6 +63,21 @@
 #define DEFAULT_AAD_TENANT ""
 #define DEFAULT_LOG_LEVEL LogLevel::Type::WARNING_LEVEL
 #define DEFAULT_MAX_ROW_PER_PAGE -1
+#define DEFAULT_PREFETCH_PAGES 2
+#define DEFAULT_METADATA_CACHE_SIZE 100
+#define DEFAULT_METADATA_CACHE_TTL 300
+#define DEFAULT_FIRST_PAGE_SIZE 0
+#define DEFAULT_PAGE_MEMORY_BUDGET 64
+#define DEFAULT_RESULT_CACHE_TTL 0
+#define DEFAULT_RESULT_CACHE_SIZE 64
+#define DEFAULT_QUERY_COALESCING false
+#define DEFAULT_NESTED_VALUES_AS_JSON false
+#define DEFAULT_LOG_ASYNC false
+#define DEFAULT_LOG_QUEUE_SIZE 8192
+#define DEFAULT_LOG_DROP_WHEN_FULL false
+#define DEFAULT_RAW_RESPONSE_DECODING false
+#define DEFAULT_CONNECTION_VALIDATION ValidationMode::Type::FULL
+#define DEFAULT_SAML_CREDENTIALS_CACHE false
 
 using ignite::odbc::config::SettableValue;
 
@@ -158,6 +174,51 @@ class IGNITE_IMPORT_EXPORT Configuration {
 
     /** Default value for maxRowPerPage attribute */
     static const int32_t maxRowPerPage;
+
+    /** Default value for prefetchPages attribute */
+    static const int32_t prefetchPages;
+
+    /** Default value for metadataCacheSize attribute */
+    static const int32_t metadataCacheSize;
+
+    /** Default value for metadataCacheTTL attribute */
+    static const int32_t metadataCacheTTL;
+
+    /** Default value for firstPageSize attribute */
+    static const int32_t firstPageSize;
+
+    /** Default value for pageMemoryBudget attribute */
+    static const int32_t pageMemoryBudget;
+
+    /** Default value for resultCacheTTL attribute */
+    static const int32_t resultCacheTTL;
+
+    /** Default value for resultCacheSize attribute */
+    static const int32_t resultCacheSize;
+
+    /** Default value for queryCoalescing attribute */
+    static const bool queryCoalescing;
+
+    /** Default value for nestedValuesAsJson attribute */
+    static const bool nestedValuesAsJson;
+
+    /** Default value for logAsync attribute */
+    static const bool logAsync;
+
+    /** Default value for logQueueSize attribute */
+    static const int32_t logQueueSize;
+
+    /** Default value for logDropWhenFull attribute */
+    static const bool logDropWhenFull;
+
+    /** Default value for rawResponseDecoding attribute */
+    static const bool rawResponseDecoding;
+
+    /** Default value for connectionValidation attribute */
+    static const ValidationMode::Type connectionValidation;
+
+    /** Default value for samlCredentialsCache attribute */
+    static const bool samlCredentialsCache;
   };
 
   /**
@@ -750,6 +811,321 @@ class IGNITE_IMPORT_EXPORT Configuration {
    */
   bool IsMaxRowPerPageSet() const;
 
+  /**
+   * Get prefetchPages.
+   *
+   * @return value PrefetchPages.
+   */
+  int32_t GetPrefetchPages() const;
+
+  /**
+   * Set prefetchPages to save.
+   *
+   * @param value PrefetchPages.
+   */
+  void SetPrefetchPages(int32_t value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if PrefetchPages set.
+   */
+  bool IsPrefetchPagesSet() const;
+
+  /**
+   * Get metadataCacheSize.
+   *
+   * @return value MetadataCacheSize.
+   */
+  int32_t GetMetadataCacheSize() const;
+
+  /**
+   * Set metadataCacheSize to save.
+   *
+   * @param value MetadataCacheSize.
+   */
+  void SetMetadataCacheSize(int32_t value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if MetadataCacheSize set.
+   */
+  bool IsMetadataCacheSizeSet() const;
+
+  /**
+   * Get metadataCacheTTL.
+   *
+   * @return value MetadataCacheTTL.
+   */
+  int32_t GetMetadataCacheTTL() const;
+
+  /**
+   * Set metadataCacheTTL to save.
+   *
+   * @param value MetadataCacheTTL.
+   */
+  void SetMetadataCacheTTL(int32_t value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if MetadataCacheTTL set.
+   */
+  bool IsMetadataCacheTTLSet() const;
+
+  /**
+   * Get firstPageSize.
+   *
+   * @return value FirstPageSize.
+   */
+  int32_t GetFirstPageSize() const;
+
+  /**
+   * Set firstPageSize to save.
+   *
+   * @param value FirstPageSize.
+   */
+  void SetFirstPageSize(int32_t value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if FirstPageSize set.
+   */
+  bool IsFirstPageSizeSet() const;
+
+  /**
+   * Get pageMemoryBudget.
+   *
+   * @return value PageMemoryBudget.
+   */
+  int32_t GetPageMemoryBudget() const;
+
+  /**
+   * Set pageMemoryBudget to save.
+   *
+   * @param value PageMemoryBudget.
+   */
+  void SetPageMemoryBudget(int32_t value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if PageMemoryBudget set.
+   */
+  bool IsPageMemoryBudgetSet() const;
+
+  /**
+   * Get resultCacheTTL.
+   *
+   * @return value ResultCacheTTL.
+   */
+  int32_t GetResultCacheTTL() const;
+
+  /**
+   * Set resultCacheTTL to save.
+   *
+   * @param value ResultCacheTTL.
+   */
+  void SetResultCacheTTL(int32_t value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if ResultCacheTTL set.
+   */
+  bool IsResultCacheTTLSet() const;
+
+  /**
+   * Get resultCacheSize.
+   *
+   * @return value ResultCacheSize.
+   */
+  int32_t GetResultCacheSize() const;
+
+  /**
+   * Set resultCacheSize to save.
+   *
+   * @param value ResultCacheSize.
+   */
+  void SetResultCacheSize(int32_t value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if ResultCacheSize set.
+   */
+  bool IsResultCacheSizeSet() const;
+
+  /**
+   * Get queryCoalescing.
+   *
+   * @return value QueryCoalescing.
+   */
+  bool GetQueryCoalescing() const;
+
+  /**
+   * Set queryCoalescing to save.
+   *
+   * @param value QueryCoalescing.
+   */
+  void SetQueryCoalescing(bool value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if QueryCoalescing set.
+   */
+  bool IsQueryCoalescingSet() const;
+
+  /**
+   * Get nestedValuesAsJson.
+   *
+   * @return value NestedValuesAsJson.
+   */
+  bool GetNestedValuesAsJson() const;
+
+  /**
+   * Set nestedValuesAsJson to save.
+   *
+   * @param value NestedValuesAsJson.
+   */
+  void SetNestedValuesAsJson(bool value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if NestedValuesAsJson set.
+   */
+  bool IsNestedValuesAsJsonSet() const;
+
+  /**
+   * Get logAsync.
+   *
+   * @return value LogAsync.
+   */
+  bool GetLogAsync() const;
+
+  /**
+   * Set logAsync to save.
+   *
+   * @param value LogAsync.
+   */
+  void SetLogAsync(bool value);
+
+  /**
+   * Check if LogAsync set.
+   *
+   * @return @true if LogAsync set.
+   */
+  bool IsLogAsyncSet() const;
+
+  /**
+   * Get logQueueSize.
+   *
+   * @return value LogQueueSize.
+   */
+  int32_t GetLogQueueSize() const;
+
+  /**
+   * Set logQueueSize to save.
+   *
+   * @param value LogQueueSize.
+   */
+  void SetLogQueueSize(int32_t value);
+
+  /**
+   * Check if LogQueueSize set.
+   *
+   * @return @true if LogQueueSize set.
+   */
+  bool IsLogQueueSizeSet() const;
+
+  /**
+   * Get logDropWhenFull.
+   *
+   * @return value LogDropWhenFull.
+   */
+  bool GetLogDropWhenFull() const;
+
+  /**
+   * Set logDropWhenFull to save.
+   *
+   * @param value LogDropWhenFull.
+   */
+  void SetLogDropWhenFull(bool value);
+
+  /**
+   * Check if LogDropWhenFull set.
+   *
+   * @return @true if LogDropWhenFull set.
+   */
+  bool IsLogDropWhenFullSet() const;
+
+  /**
+   * Get rawResponseDecoding.
+   *
+   * @return value RawResponseDecoding.
+   */
+  bool GetRawResponseDecoding() const;
+
+  /**
+   * Set rawResponseDecoding to save.
+   *
+   * @param value RawResponseDecoding.
+   */
+  void SetRawResponseDecoding(bool value);
+
+  /**
+   * Check if RawResponseDecoding set.
+   *
+   * @return @true if RawResponseDecoding set.
+   */
+  bool IsRawResponseDecodingSet() const;
+
+  /**
+   * Get connectionValidation.
+   *
+   * @return value ConnectionValidation.
+   */
+  ValidationMode::Type GetConnectionValidation() const;
+
+  /**
+   * Set connectionValidation to save.
+   *
+   * @param value ConnectionValidation.
+   */
+  void SetConnectionValidation(const ValidationMode::Type value);
+
+  /**
+   * Check if ConnectionValidation set.
+   *
+   * @return @true if ConnectionValidation set.
+   */
+  bool IsConnectionValidationSet() const;
+
+  /**
+   * Get samlCredentialsCache.
+   *
+   * @return value SAMLCredentialsCache.
+   */
+  bool GetSAMLCredentialsCache() const;
+
+  /**
+   * Set samlCredentialsCache to save.
+   *
+   * @param value SAMLCredentialsCache.
+   */
+  void SetSAMLCredentialsCache(bool value);
+
+  /**
+   * Check if SAMLCredentialsCache set.
+   *
+   * @return @true if SAMLCredentialsCache set.
+   */
+  bool IsSAMLCredentialsCacheSet() const;
+
   /**
    * Get argument map.
    *
@@ -867,6 +1243,54 @@ class IGNITE_IMPORT_EXPORT Configuration {
 
   /** The max row number in one page returned from SW */
   SettableValue< int32_t > maxRowPerPage = DefaultValue::maxRowPerPage;
+
+  /** The max number of result pages fetched ahead of the cursor */
+  SettableValue< int32_t > prefetchPages = DefaultValue::prefetchPages;
+
+  /** Max number of result set metadata entries cached by a connection */
+  SettableValue< int32_t > metadataCacheSize = DefaultValue::metadataCacheSize;
+
+  /** Seconds a cached result set metadata entry stays valid */
+  SettableValue< int32_t > metadataCacheTTL = DefaultValue::metadataCacheTTL;
+
+  /** Rows of the first page with adaptive page sizing, 0 disables it */
+  SettableValue< int32_t > firstPageSize = DefaultValue::firstPageSize;
+
+  /** Memory in MB the fetched result pages of a statement may take */
+  SettableValue< int32_t > pageMemoryBudget = DefaultValue::pageMemoryBudget;
+
+  /** Seconds a cached query result stays valid, 0 disables the cache */
+  SettableValue< int32_t > resultCacheTTL = DefaultValue::resultCacheTTL;
+
+  /** Memory in MB the cached query results may take */
+  SettableValue< int32_t > resultCacheSize = DefaultValue::resultCacheSize;
+
+  /** Share one page stream between identical concurrent queries */
+  SettableValue< bool > queryCoalescing = DefaultValue::queryCoalescing;
+
+  /** Render ARRAY and ROW values as JSON */
+  SettableValue< bool > nestedValuesAsJson = DefaultValue::nestedValuesAsJson;
+
+  /** Write the log file on a background thread */
+  SettableValue< bool > logAsync = DefaultValue::logAsync;
+
+  /** Max number of log messages waiting for the background thread */
+  SettableValue< int32_t > logQueueSize = DefaultValue::logQueueSize;
+
+  /** Drop log messages instead of waiting when the queue is full */
+  SettableValue< bool > logDropWhenFull = DefaultValue::logDropWhenFull;
+
+  /** Decode the query responses without the SDK model */
+  SettableValue< bool > rawResponseDecoding =
+      DefaultValue::rawResponseDecoding;
+
+  /** How the connection is validated on connect */
+  SettableValue< ValidationMode::Type > connectionValidation =
+      DefaultValue::connectionValidation;
+
+  /** Share the SAML credentials across the connections of the process */
+  SettableValue< bool > samlCredentialsCache =
+      DefaultValue::samlCredentialsCache;
 };
 
 template <>
@@ -897,6 +1321,11 @@ template <>
 void Configuration::AddToMap< LogLevel::Type >(
     ArgumentMap& map, const std::string& key,
     const SettableValue< LogLevel::Type >& value);
+
+template <>
+void Configuration::AddToMap< ValidationMode::Type >(
+    ArgumentMap& map, const std::string& key,
+    const SettableValue< ValidationMode::Type >& value);
 }  // namespace config
 }  // namespace odbc
 }  // namespace iotsitewise
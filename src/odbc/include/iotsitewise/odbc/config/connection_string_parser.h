@@ -116,6 +116,51 @@ class IGNITE_IMPORT_EXPORT ConnectionStringParser {
 
     /** Max number of rows in one page returned from SW. */
     static const std::string maxRowPerPage;
+
+    /** Max number of result pages fetched ahead of the cursor. */
+    static const std::string prefetchPages;
+
+    /** Max number of result set metadata entries cached by a connection. */
+    static const std::string metadataCacheSize;
+
+    /** Seconds a cached result set metadata entry stays valid. */
+    static const std::string metadataCacheTTL;
+
+    /** Rows of the first page with adaptive page sizing, 0 disables it. */
+    static const std::string firstPageSize;
+
+    /** Memory in MB the fetched result pages of a statement may take. */
+    static const std::string pageMemoryBudget;
+
+    /** Seconds a cached query result stays valid, 0 disables the cache. */
+    static const std::string resultCacheTTL;
+
+    /** Memory in MB the cached query results may take. */
+    static const std::string resultCacheSize;
+
+    /** Share one page stream between identical concurrent queries. */
+    static const std::string queryCoalescing;
+
+    /** Render ARRAY and ROW values as JSON. */
+    static const std::string nestedValuesAsJson;
+
+    /** Write the log file on a background thread. */
+    static const std::string logAsync;
+
+    /** Max number of log messages waiting for the background thread. */
+    static const std::string logQueueSize;
+
+    /** Drop log messages instead of waiting when the queue is full. */
+    static const std::string logDropWhenFull;
+
+    /** Decode the query responses without the SDK model. */
+    static const std::string rawResponseDecoding;
+
+    /** How the connection is validated on connect. */
+    static const std::string connectionValidation;
+
+    /** Share the SAML credentials across the connections of the process. */
+    static const std::string samlCredentialsCache;
   };
 
   /**
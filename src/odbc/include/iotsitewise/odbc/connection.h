@@ -23,6 +23,7 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <vector>
 
 #include "iotsitewise/odbc/config/configuration.h"
@@ -31,8 +32,11 @@
 #include "iotsitewise/odbc/log.h"
 #include "iotsitewise/odbc/ignite_error.h"
 #include "ignite/odbc/odbc_error.h"
+#include "iotsitewise/odbc/authentication/refreshing_credentials_provider.h"
 #include "iotsitewise/odbc/authentication/saml.h"
 #include "iotsitewise/odbc/descriptor.h"
+#include "iotsitewise/odbc/meta/result_set_meta_cache.h"
+#include "iotsitewise/odbc/query_client.h"
 
 #include <aws/core/Aws.h>
 #include <aws/core/auth/AWSCredentials.h>
@@ -55,6 +59,8 @@ struct StatementAttributes {
   SqlUlen retrieveData;
   SqlUlen rowsetSize;
   SqlUlen rowArraySize;
+  SqlUlen queryTimeout;
+  SqlUlen maxRows;
 };
 
 /**
@@ -74,6 +80,9 @@ class IGNITE_IMPORT_EXPORT Connection : public diagnostic::DiagnosableAdapter {
   /** Default connection timeout in seconds. */
   enum { DEFAULT_CONNECT_TIMEOUT = 5 };
 
+  /** Maximum number of client keys remembered by the ONCE validation. */
+  enum { MAX_VALIDATED_CLIENTS = 1024 };
+
   /**
    * Destructor.
    */
@@ -148,8 +157,7 @@ class IGNITE_IMPORT_EXPORT Connection : public diagnostic::DiagnosableAdapter {
    *
    * @return Shared Pointer to IoT SiteWise client.
    */
-  std::shared_ptr< Aws::IoTSiteWise::IoTSiteWiseClient >
-  GetClient() const;
+  std::shared_ptr< QueryClient > GetClient() const;
 
   /**
    * Create statement associated with the connection.
@@ -239,6 +247,46 @@ class IGNITE_IMPORT_EXPORT Connection : public diagnostic::DiagnosableAdapter {
     return samlCredProvider_;
   }
 
+  /**
+   * Get the result set metadata cache shared by the statements.
+   *
+   * @return Result set metadata cache.
+   */
+  meta::ResultSetMetaCache& GetMetaCache() {
+    return metaCache_;
+  }
+
+  /**
+   * Get identity of the connection credentials. Connections with the same
+   * identity and credentials digest share the cached query results.
+   *
+   * @return Credentials identity.
+   */
+  std::string GetCredentialsIdentity() const;
+
+  /**
+   * Get digest of the secrets of the connection credentials. Connections
+   * with the same identity but other secrets must not share the results of
+   * each other, as they may have never been authenticated.
+   *
+   * @return Digest of the secrets, empty for AWS_PROFILE.
+   */
+  std::string GetCredentialsDigest() const;
+
+  /**
+   * Count a query execution answered by the query result cache.
+   */
+  void AddResultCacheHit() {
+    resultCacheHits_++;
+  }
+
+  /**
+   * Count a query execution not answered by the query result cache.
+   */
+  void AddResultCacheMiss() {
+    resultCacheMisses_++;
+  }
+
   /**
    * Create a descriptor.
    *
@@ -322,27 +370,29 @@ class IGNITE_IMPORT_EXPORT Connection : public diagnostic::DiagnosableAdapter {
   Connection(Environment* env);
 
   /**
-   * Create IoTSiteWiseClient object.
+   * Create IoTSiteWiseClient object, or get the one shared by the
+   * connections with the same settings from the ClientRegistry. The client
+   * renews its credentials before they expire if the auth type allows it.
    *
    * @param credentials AWS IAM credentials.
    * @param clientCfg AWS client configuration.
    * @return a shared_ptr to created IoTSiteWiseClient object.
    */
-  virtual std::shared_ptr< Aws::IoTSiteWise::IoTSiteWiseClient >
+  virtual std::shared_ptr< QueryClient >
   CreateIoTSiteWiseClient(const Aws::Auth::AWSCredentials& credentials,
                       const Aws::Client::ClientConfiguration& clientCfg);
 
   /**
-   * Create Aws HttpClient object.
+   * Get the Aws HttpClient object shared by the connections of the process.
    *
-   * @return a shared_ptr to created HttpClient object.
+   * @return a shared_ptr to HttpClient object.
    */
   virtual std::shared_ptr< Aws::Http::HttpClient > GetHttpClient();
 
   /**
-   * Create Aws STSClient object.
+   * Get the Aws STSClient object shared by the connections of the process.
    *
-   * @return a shared_ptr to created STSClient object.
+   * @return a shared_ptr to STSClient object.
    */
   virtual std::shared_ptr< Aws::STS::STSClient > GetStsClient();
 
@@ -584,6 +634,40 @@ class IGNITE_IMPORT_EXPORT Connection : public diagnostic::DiagnosableAdapter {
    */
   bool TryRestoreConnection(const config::Configuration& cfg, IgniteError& err);
 
+  /**
+   * Get the credentials of the SAML credentials provider, from the
+   * SAMLCredentialsCache if the SAMLCredentialsCache option is set.
+   *
+   * @param cfg Configuration.
+   * @param credentials AWS credentials.
+   * @param errInfo Error message when there is a failure.
+   * @return @c true on success and @c false otherwise.
+   */
+  bool GetSAMLCredentials(const config::Configuration& cfg,
+                          Aws::Auth::AWSCredentials& credentials,
+                          std::string& errInfo);
+
+  /**
+   * Make the function renewing the credentials with the SAML credentials
+   * provider.
+   *
+   * @return Function renewing the credentials.
+   */
+  RefreshingCredentialsProvider::Fetcher MakeSAMLCredentialsFetcher();
+
+  /**
+   * Validate the credentials with a probe query, as set by the
+   * ConnectionValidation option.
+   *
+   * @param credentials AWS credentials of the client.
+   * @param clientCfg AWS client configuration.
+   * @param err Error on failure.
+   * @return @c true on success and @c false otherwise.
+   */
+  bool ValidateConnection(const Aws::Auth::AWSCredentials& credentials,
+                          const Aws::Client::ClientConfiguration& clientCfg,
+                          IgniteError& err);
+
   /**
    * Set client proxy properties based on related environment variables
    *
@@ -611,11 +695,26 @@ class IGNITE_IMPORT_EXPORT Connection : public diagnostic::DiagnosableAdapter {
   config::ConnectionInfo info_;
 
   /** IoT SiteWise client. */
-  std::shared_ptr< Aws::IoTSiteWise::IoTSiteWiseClient > client_;
+  std::shared_ptr< QueryClient > client_;
 
   /** SAML credentials provider */
   std::shared_ptr< IoTSiteWiseSAMLCredentialsProvider > samlCredProvider_;
 
+  /** Function renewing the credentials, empty if they are not renewed */
+  RefreshingCredentialsProvider::Fetcher credentialsFetcher_;
+
+  /** Result set metadata cache */
+  meta::ResultSetMetaCache metaCache_;
+
+  /** Flag indicating the connection holds the background log writer */
+  bool isLogAsync_ = false;
+
+  /** Number of query executions answered by the query result cache */
+  std::atomic< uint64_t > resultCacheHits_;
+
+  /** Number of query executions not answered by the query result cache */
+  std::atomic< uint64_t > resultCacheMisses_;
+
   /** Aws SDK options. */
   Aws::SDKOptions options_;
 
@@ -628,6 +727,21 @@ class IGNITE_IMPORT_EXPORT Connection : public diagnostic::DiagnosableAdapter {
   /** This class object count */
   static std::atomic< int > refCount_;
 
+  /** mutex for the validated clients */
+  static std::mutex validatedMutex_;
+
+  /**
+   * Digests of the clients validated by the ONCE connection validation.
+   * Holds at most MAX_VALIDATED_CLIENTS entries, cleared at SDK shutdown.
+   */
+  static std::set< std::string > validated_;
+
+  /** HttpClient shared by the IdP requests of all connections */
+  static std::shared_ptr< Aws::Http::HttpClient > sharedHttpClient_;
+
+  /** STSClient shared by the SAML requests of all connections */
+  static std::shared_ptr< Aws::STS::STSClient > sharedStsClient_;
+
   /** mutex for cursor names update */
   std::mutex cursorNameMutex_;
 
@@ -645,6 +759,8 @@ class IGNITE_IMPORT_EXPORT Connection : public diagnostic::DiagnosableAdapter {
     SQL_RD_OFF,               // retrieveData
     1,                        // rowsetSize
     1,                        // rowArraySize
+    0,                        // queryTimeout
+    0,                        // maxRows
   };
 };
 }  // namespace odbc
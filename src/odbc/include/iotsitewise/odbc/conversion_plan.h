@@ -0,0 +1,194 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _IOTSITEWISE_ODBC_CONVERSION_PLAN
+#define _IOTSITEWISE_ODBC_CONVERSION_PLAN
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <aws/iotsitewise/model/ScalarType.h>
+
+#include "ignite/common/common.h"
+#include "iotsitewise/odbc/app/application_data_buffer.h"
+#include "iotsitewise/odbc/decoded_page.h"
+#include "iotsitewise/odbc/type_traits.h"
+
+namespace iotsitewise {
+namespace odbc {
+/**
+ * Converters of the bound columns of a query. The scalar type of a decoded
+ * column and the C type of the buffer it is bound to are fixed for the
+ * execution, so each column is resolved once to a converter specialized for
+ * the pair, and the values are then copied without switching on the types.
+ */
+class IGNITE_IMPORT_EXPORT ConversionPlan {
+ public:
+  /**
+   * Converter of a decoded value to an application data buffer.
+   *
+   * @param column Decoded column.
+   * @param rowIdx Row index, start from 0.
+   * @param dataBuf Application data buffer.
+   * @return Conversion result.
+   */
+  typedef app::ConversionResult::Type (*Converter)(
+      const DecodedPage::Column& column, size_t rowIdx,
+      app::ApplicationDataBuffer& dataBuf);
+
+  /**
+   * Converter of a range of decoded values to the elements of an
+   * application data buffer array, starting at the current element of the
+   * buffer.
+   *
+   * @param column Decoded column.
+   * @param firstRow Index of the first row, start from 0.
+   * @param rowCount Number of rows.
+   * @param dataBuf Application data buffer.
+   * @param results Conversion result of each row.
+   */
+  typedef void (*BulkConverter)(const DecodedPage::Column& column,
+                                size_t firstRow, size_t rowCount,
+                                app::ApplicationDataBuffer& dataBuf,
+                                app::ConversionResult::Type* results);
+
+  /**
+   * Constructor.
+   */
+  ConversionPlan() = default;
+
+  /**
+   * Destructor.
+   */
+  ~ConversionPlan() = default;
+
+  /**
+   * Get the converter for a pair of types.
+   *
+   * @param source Scalar type of the decoded column.
+   * @param target C type of the application data buffer.
+   * @return Converter.
+   */
+  static Converter Resolve(Aws::IoTSiteWise::Model::ScalarType source,
+                           type_traits::OdbcNativeType::Type target);
+
+  /**
+   * Get the bulk converter for a pair of types.
+   *
+   * @param source Scalar type of the decoded column.
+   * @param target C type of the application data buffer.
+   * @return Bulk converter, or nullptr if the values of the pair are
+   * converted one by one.
+   */
+  static BulkConverter ResolveBulk(Aws::IoTSiteWise::Model::ScalarType source,
+                                   type_traits::OdbcNativeType::Type target);
+
+  /**
+   * Get the converter of a column. It is resolved on the first use and again
+   * only if the column is bound to a buffer of another type.
+   *
+   * @param columnIdx Column index, start from 1.
+   * @param source Scalar type of the decoded column.
+   * @param target C type of the application data buffer.
+   * @return Converter.
+   */
+  Converter Get(uint32_t columnIdx, Aws::IoTSiteWise::Model::ScalarType source,
+                type_traits::OdbcNativeType::Type target) {
+    return GetEntry(columnIdx, source, target).converter;
+  }
+
+  /**
+   * Get the bulk converter of a column, see Get.
+   *
+   * @param columnIdx Column index, start from 1.
+   * @param source Scalar type of the decoded column.
+   * @param target C type of the application data buffer.
+   * @return Bulk converter, or nullptr if the values of the column are
+   * converted one by one.
+   */
+  BulkConverter GetBulk(uint32_t columnIdx,
+                        Aws::IoTSiteWise::Model::ScalarType source,
+                        type_traits::OdbcNativeType::Type target) {
+    return GetEntry(columnIdx, source, target).bulkConverter;
+  }
+
+  /**
+   * Drop the resolved converters.
+   */
+  void Reset() {
+    entries_.clear();
+  }
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(ConversionPlan);
+
+  /** Resolved converter of a column. */
+  struct Entry {
+    Entry()
+        : source(Aws::IoTSiteWise::Model::ScalarType::NOT_SET),
+          target(type_traits::OdbcNativeType::Type::AI_UNSUPPORTED),
+          converter(nullptr),
+          bulkConverter(nullptr) {
+    }
+
+    /** Scalar type the converter is resolved for. */
+    Aws::IoTSiteWise::Model::ScalarType source;
+
+    /** C type the converter is resolved for. */
+    type_traits::OdbcNativeType::Type target;
+
+    /** Converter. */
+    Converter converter;
+
+    /** Bulk converter. */
+    BulkConverter bulkConverter;
+  };
+
+  /**
+   * Get the converters of a column, resolved on the first use and again
+   * only if the column is bound to a buffer of another type.
+   *
+   * @param columnIdx Column index, start from 1.
+   * @param source Scalar type of the decoded column.
+   * @param target C type of the application data buffer.
+   * @return Resolved converters.
+   */
+  const Entry& GetEntry(uint32_t columnIdx,
+                        Aws::IoTSiteWise::Model::ScalarType source,
+                        type_traits::OdbcNativeType::Type target) {
+    if (columnIdx >= entries_.size()) {
+      entries_.resize(columnIdx + 1);
+    }
+
+    Entry& entry = entries_[columnIdx];
+    if (!entry.converter || entry.source != source
+        || entry.target != target) {
+      entry.source = source;
+      entry.target = target;
+      entry.converter = Resolve(source, target);
+      entry.bulkConverter = ResolveBulk(source, target);
+    }
+    return entry;
+  }
+
+  /** Converters by column index. */
+  std::vector< Entry > entries_;
+};
+}  // namespace odbc
+}  // namespace iotsitewise
+
+#endif  //_IOTSITEWISE_ODBC_CONVERSION_PLAN
@@ -0,0 +1,200 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _IOTSITEWISE_ODBC_DECODED_PAGE
+#define _IOTSITEWISE_ODBC_DECODED_PAGE
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <aws/iotsitewise/model/ColumnInfo.h>
+#include <aws/iotsitewise/model/ExecuteQueryResult.h>
+#include <aws/iotsitewise/model/Row.h>
+#include <aws/iotsitewise/model/ScalarType.h>
+
+#include "ignite/common/common.h"
+#include "iotsitewise/odbc/app/application_data_buffer.h"
+#include "iotsitewise/odbc/timestamp.h"
+
+namespace iotsitewise {
+namespace odbc {
+/**
+ * Result page with its numeric, boolean and timestamp columns decoded into
+ * typed arrays. The page is decoded once when it is fetched, so reading a
+ * value to the application buffer is a typed copy instead of parsing text.
+ *
+ * Columns of other types, and columns holding a value that could not be
+ * decoded, are read from the rows of the page as before.
+ */
+class IGNITE_IMPORT_EXPORT DecodedPage {
+ public:
+  /** Decoded values of a column. Only the array of its type is filled. */
+  struct Column {
+    Column()
+        : type(Aws::IoTSiteWise::Model::ScalarType::NOT_SET),
+          isDecoded(false) {
+    }
+
+    /** Scalar type of the column. */
+    Aws::IoTSiteWise::Model::ScalarType type;
+
+    /** Flag indicating the values are decoded. */
+    bool isDecoded;
+
+    /** Null bitmap, one bit per row. */
+    std::vector< bool > nulls;
+
+    /** Values of a DOUBLE column. */
+    std::vector< double > doubles;
+
+    /** Values of an INT or BOOLEAN column. */
+    std::vector< int32_t > ints;
+
+    /** Values of a TIMESTAMP column. */
+    std::vector< Timestamp > timestamps;
+  };
+
+  /**
+   * Constructor. Decodes the columns of the page.
+   *
+   * @param result Page returned by the service.
+   */
+  explicit DecodedPage(Aws::IoTSiteWise::Model::ExecuteQueryResult result);
+
+  /**
+   * Constructor. Takes the columns decoded along with the response, the
+   * rows of the page only hold the values of the other columns.
+   *
+   * @param result Page with the values of the columns not decoded.
+   * @param columns Columns, one per column of the page.
+   */
+  DecodedPage(Aws::IoTSiteWise::Model::ExecuteQueryResult result,
+              std::vector< Column > columns);
+
+  /**
+   * Destructor.
+   */
+  ~DecodedPage() = default;
+
+  /**
+   * Get the page returned by the service.
+   *
+   * @return Page.
+   */
+  const Aws::IoTSiteWise::Model::ExecuteQueryResult& GetResult() const {
+    return result_;
+  }
+
+  /**
+   * Get rows of the page.
+   *
+   * @return Rows.
+   */
+  const Aws::Vector< Aws::IoTSiteWise::Model::Row >& GetRows() const {
+    return result_.GetRows();
+  }
+
+  /**
+   * Get columns of the page.
+   *
+   * @return Columns.
+   */
+  const Aws::Vector< Aws::IoTSiteWise::Model::ColumnInfo >& GetColumns()
+      const {
+    return result_.GetColumns();
+  }
+
+  /**
+   * Get token of the next page.
+   *
+   * @return Next token, empty for the last page.
+   */
+  const Aws::String& GetNextToken() const {
+    return result_.GetNextToken();
+  }
+
+  /**
+   * Check if a column is decoded.
+   *
+   * @param columnIdx Column index, start from 0.
+   * @return True if the values of the column are decoded.
+   */
+  bool IsDecoded(uint32_t columnIdx) const {
+    return columnIdx < columns_.size() && columns_[columnIdx].isDecoded;
+  }
+
+  /**
+   * Get a decoded column.
+   *
+   * @param columnIdx Index of a decoded column, start from 0.
+   * @return Column.
+   */
+  const Column& GetColumn(uint32_t columnIdx) const {
+    return columns_[columnIdx];
+  }
+
+  /**
+   * Read a decoded value and store it in application data buffer.
+   *
+   * @param rowIdx Row index, start from 0.
+   * @param columnIdx Index of a decoded column, start from 0.
+   * @param dataBuf Application data buffer.
+   * @return Conversion result.
+   */
+  app::ConversionResult::Type ReadToBuffer(
+      size_t rowIdx, uint32_t columnIdx,
+      app::ApplicationDataBuffer& dataBuf) const;
+
+  /**
+   * Get memory taken by the decoded values.
+   *
+   * @return Size in bytes.
+   */
+  size_t GetDecodedBytes() const;
+
+  /**
+   * Decode a value and append it to a column.
+   *
+   * @param column Column of a decoded type.
+   * @param value Value text, nullptr for a null value.
+   * @param len Length of the text.
+   * @return True if the value is decoded.
+   */
+  static bool AppendValue(Column& column, const char* value, size_t len);
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(DecodedPage);
+
+  /**
+   * Decode values of a column.
+   *
+   * @param columnIdx Column index, start from 0.
+   * @param column Column to fill.
+   * @return True if all values are decoded.
+   */
+  bool DecodeColumn(uint32_t columnIdx, Column& column) const;
+
+  /** Page returned by the service. */
+  Aws::IoTSiteWise::Model::ExecuteQueryResult result_;
+
+  /** Decoded columns. */
+  std::vector< Column > columns_;
+};
+}  // namespace odbc
+}  // namespace iotsitewise
+
+#endif  //_IOTSITEWISE_ODBC_DECODED_PAGE
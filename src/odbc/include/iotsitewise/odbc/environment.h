@@ -21,9 +21,11 @@
 #ifndef _IOTSITEWISE_ODBC_ENVIRONMENT
 #define _IOTSITEWISE_ODBC_ENVIRONMENT
 
+#include <memory>
 #include <set>
 
 #include "iotsitewise/odbc/diagnostic/diagnosable_adapter.h"
+#include "iotsitewise/odbc/thread_pool.h"
 
 namespace iotsitewise {
 namespace odbc {
@@ -121,6 +123,12 @@ class IGNITE_IMPORT_EXPORT Environment : public diagnostic::DiagnosableAdapter {
 
   /** ODBC null-termintaion of string behaviour. */
   int32_t odbcNts;
+
+  /**
+   * Process-wide thread pool for background work. Holding it keeps the
+   * pool alive as long as the environment exists.
+   */
+  std::shared_ptr< ThreadPool > threadPool;
 };
 }  // namespace odbc
 }  // namespace iotsitewise
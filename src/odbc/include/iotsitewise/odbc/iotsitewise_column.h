@@ -22,6 +22,7 @@
 #define _IOTSITEWISE_ODBC_IGNITE_COLUMN
 
 #include <stdint.h>
+#include <string>
 #include <iotsitewise/odbc/app/application_data_buffer.h>
 #include "iotsitewise/odbc/meta/column_meta.h"
 #include <aws/iotsitewise/model/Row.h>
@@ -43,9 +44,11 @@ class IoTSiteWiseColumn {
    *
    * @param columnIdx The column index, start from 0.
    * @param columnMetadata The column metadata.
+   * @param nestedAsJson Render ARRAY and ROW values as JSON.
    */
   IoTSiteWiseColumn(
-                   uint32_t columnIdx, const meta::ColumnMeta& columnMetadata);
+                   uint32_t columnIdx, const meta::ColumnMeta& columnMetadata,
+                   bool nestedAsJson = false);
 
   /**
    * Copy constructor.
@@ -77,6 +80,24 @@ class IoTSiteWiseColumn {
   ConversionResult::Type ReadToBuffer(const Datum& datum,
                                       ApplicationDataBuffer& dataBuf) const;
 
+  /**
+   * Parse a TIMESTAMP value, formatted as "yyyy-mm-dd hh:mm:ss.fffffffff".
+   * A value not in this format is parsed field by field with sscanf.
+   *
+   * @param value Timestamp string.
+   * @return Timestamp.
+   */
+  static Timestamp ParseTimestamp(const Aws::String& value);
+
+  /**
+   * Parse a TIMESTAMP value, see ParseTimestamp.
+   *
+   * @param text Timestamp text, not necessarily null-terminated.
+   * @param len Length of the text.
+   * @return Timestamp.
+   */
+  static Timestamp ParseTimestamp(const char* text, size_t len);
+
  private:
   /**
    * Parse Aws Datum data and save result to dataBuf
@@ -99,30 +120,48 @@ class IoTSiteWiseColumn {
                                          ApplicationDataBuffer& dataBuf) const;
 
   /**
-   * Parse Array data type in datum and save result to dataBuf.
+   * Serialize an ARRAY or ROW value and save result to dataBuf. The value
+   * is written to one string that is reused by the next calls, so reading
+   * it in parts with SQLGetData serializes it once.
    *
    * @param datum Aws datum which contains the result data
    * @param dataBuf Application data buffer.
    * @return Operation result.
    */
-  ConversionResult::Type ParseArrayType(const Datum& datum,
-                                        ApplicationDataBuffer& dataBuf) const;
+  ConversionResult::Type ParseNestedType(const Datum& datum,
+                                         ApplicationDataBuffer& dataBuf) const;
 
   /**
-   * Parse Row data type in datum and save result to dataBuf.
+   * Append a value as text, "[a,b]" for an array and "(a,b)" for a row.
+   * Null values are empty.
    *
-   * @param datum Aws datum which contains the result data
-   * @param dataBuf Application data buffer.
-   * @return Operation result.
+   * @param datum Aws datum.
+   * @param out String to append to.
    */
-  ConversionResult::Type ParseRowType(const Datum& datum,
-                                      ApplicationDataBuffer& dataBuf) const;
+  void WriteText(const Datum& datum, std::string& out) const;
+
+  /**
+   * Append a value as JSON. Arrays and rows are JSON arrays.
+   *
+   * @param datum Aws datum.
+   * @param out String to append to.
+   */
+  void WriteJson(const Datum& datum, std::string& out) const;
 
   /** The column index */
   uint32_t columnIdx_;
 
   /** The column metadata */
   const meta::ColumnMeta& columnMeta_;
+
+  /** Render ARRAY and ROW values as JSON. */
+  bool nestedAsJson_;
+
+  /** Value serialized last, the datum is owned by the page of the cursor. */
+  mutable const Datum* serializedDatum_;
+
+  /** Serialized value of serializedDatum_. */
+  mutable std::string serialized_;
 };
 }  // namespace odbc
 }  // namespace iotsitewise
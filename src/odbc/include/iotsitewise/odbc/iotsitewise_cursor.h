@@ -27,12 +27,16 @@
 #include <memory>
 
 #include "iotsitewise/odbc/common_types.h"
+#include "iotsitewise/odbc/conversion_plan.h"
+#include "iotsitewise/odbc/decoded_page.h"
 #include "iotsitewise/odbc/iotsitewise_column.h"
 #include "iotsitewise/odbc/meta/column_meta.h"
 
 #include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/iotsitewise/model/ExecuteQueryResult.h>
 #include <aws/iotsitewise/model/Row.h>
 
+using Aws::IoTSiteWise::Model::ExecuteQueryResult;
 using Aws::IoTSiteWise::Model::Row;
 
 namespace iotsitewise {
@@ -44,11 +48,15 @@ class IoTSiteWiseCursor {
  public:
   /**
    * Constructor.
-   * @param rowVec Aws Row vector.
+   * The cursor shares the page with the query instead of copying its rows.
+   *
+   * @param page Result page holding the rows.
    * @param columnMetadataVec Column metadata vector.
+   * @param nestedAsJson Render ARRAY and ROW values as JSON.
    */
-  IoTSiteWiseCursor(const Aws::Vector< Row > rowVec,
-                   const meta::ColumnMetaVector& columnMetadataVec);
+  IoTSiteWiseCursor(std::shared_ptr< const DecodedPage > page,
+                   const meta::ColumnMetaVector& columnMetadataVec,
+                   bool nestedAsJson = false);
 
   /**
    * Destructor.
@@ -69,6 +77,27 @@ class IoTSiteWiseCursor {
    */
   bool HasData() const;
 
+  /**
+   * Get number of rows of the page following the current row.
+   *
+   * @return Number of rows.
+   */
+  size_t GetRowsLeft() const {
+    return curPos_ > 0 && static_cast< size_t >(curPos_) < rowVec_.size()
+               ? rowVec_.size() - curPos_
+               : 0;
+  }
+
+  /**
+   * Move cursor forward by a number of rows of the page.
+   *
+   * @param count Number of rows, not more than GetRowsLeft().
+   */
+  void Advance(size_t count) {
+    iterator_ += count;
+    curPos_ += static_cast< int >(count);
+  }
+
   /**
    * Get column number in a row.
    *
@@ -88,6 +117,37 @@ class IoTSiteWiseCursor {
   app::ConversionResult::Type ReadColumnToBuffer(
       uint32_t columnIdx, app::ApplicationDataBuffer& dataBuf);
 
+  /**
+   * Read column data and store it in the bound application data buffer.
+   * A decoded column is copied with the converter of the plan.
+   *
+   * @param columnIdx Column index.
+   * @param dataBuf Application data buffer.
+   * @param plan Conversion plan of the bound columns.
+   * @return Conversion result.
+   */
+  app::ConversionResult::Type ReadColumnToBuffer(
+      uint32_t columnIdx, app::ApplicationDataBuffer& dataBuf,
+      ConversionPlan& plan);
+
+  /**
+   * Read column data of the rows starting at the current row and store it
+   * in consecutive elements of the bound application data buffer array.
+   * The cursor is not moved.
+   *
+   * @param columnIdx Column index.
+   * @param dataBuf Application data buffer.
+   * @param firstElement Index of the element of the first row.
+   * @param rowCount Number of rows, not more than GetRowsLeft() + 1.
+   * @param plan Conversion plan of the bound columns.
+   * @param results Conversion result of each row.
+   */
+  void ReadColumnToBuffers(uint32_t columnIdx,
+                           app::ApplicationDataBuffer& dataBuf,
+                           SqlUlen firstElement, size_t rowCount,
+                           ConversionPlan& plan,
+                           app::ConversionResult::Type* results);
+
  private:
   IGNITE_NO_COPY_ASSIGNMENT(IoTSiteWiseCursor);
 
@@ -116,8 +176,11 @@ class IoTSiteWiseCursor {
    */
   bool EnsureColumnDiscovered(uint32_t columnIdx);
 
+  /** Result page owning the rows */
+  std::shared_ptr< const DecodedPage > page_;
+
   /** Resultset rows */
-  const Aws::Vector< Row > rowVec_;
+  const Aws::Vector< Row >& rowVec_;
 
   /** The iterator to beginning of cursor */
   Aws::Vector< Row >::const_iterator iterator_;
@@ -130,6 +193,9 @@ class IoTSiteWiseCursor {
 
   /* current iterator position, start from 1 when used */
   int curPos_;
+
+  /** Render ARRAY and ROW values as JSON. */
+  bool nestedAsJson_;
 };
 }  // namespace odbc
 }  // namespace iotsitewise
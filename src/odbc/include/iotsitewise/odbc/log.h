@@ -21,66 +21,81 @@
 #ifndef _IOTSITEWISE_ODBC_LOG
 #define _IOTSITEWISE_ODBC_LOG
 
+#include <atomic>
+#include <condition_variable>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <thread>
 
 #include "ignite/common/common.h"
 #include "ignite/common/include/common/concurrent.h"
+#include "iotsitewise/odbc/async_log_queue.h"
 #include "iotsitewise/odbc/log_level.h"
 
 using ignite::odbc::common::concurrent::CriticalSection;
 
 #define DEFAULT_LOG_PATH iotsitewise::odbc::Logger::GetDefaultLogPath()
 
+// Log statements of a more verbose level are compiled out. The build option
+// DISABLE_VERBOSE_LOGGING sets it to WARNING_LEVEL.
+#ifndef IOTSITEWISE_LOG_MAX_LEVEL
+#define IOTSITEWISE_LOG_MAX_LEVEL \
+  iotsitewise::odbc::LogLevel::Type::DEBUG_LEVEL
+#endif
+
 #define WRITE_LOG_MSG(param, logLevel) \
   WRITE_MSG_TO_STREAM(param, logLevel, (std::ostream*)nullptr)
 
 #define WRITE_MSG_TO_STREAM(param, logLevel, logStream)                       \
   {                                                                           \
-    std::shared_ptr< iotsitewise::odbc::Logger > p =                           \
-        iotsitewise::odbc::Logger::GetLoggerInstance();                        \
-    if (p->GetLogLevel() >= logLevel && (p->IsEnabled() || p->EnableLog())) { \
-      std::ostream* prevStream = p.get()->GetLogStream();                     \
-      if (logStream != nullptr) {                                             \
-        /* Override the stream temporarily */                                 \
-        p.get()->SetLogStream(logStream);                                     \
-      }                                                                       \
-      std::unique_ptr< iotsitewise::odbc::LogStream > lstream(                 \
-          new iotsitewise::odbc::LogStream(p.get()));                          \
-      std::string msg_prefix;                                                 \
-      switch (logLevel) {                                                     \
-        case iotsitewise::odbc::LogLevel::Type::DEBUG_LEVEL:                   \
-          msg_prefix = "DEBUG MSG: ";                                         \
-          break;                                                              \
-        case iotsitewise::odbc::LogLevel::Type::INFO_LEVEL:                    \
-          msg_prefix = "INFO MSG: ";                                          \
-          break;                                                              \
-        case iotsitewise::odbc::LogLevel::Type::WARNING_LEVEL:                 \
-          msg_prefix = "WARNING MSG: ";                                       \
-          break;                                                              \
-        case iotsitewise::odbc::LogLevel::Type::ERROR_LEVEL:                   \
-          msg_prefix = "ERROR MSG: ";                                         \
-          break;                                                              \
-        default:                                                              \
-          msg_prefix = "";                                                    \
-      }                                                                       \
-      char tStr[1000];                                                        \
-      time_t curTime = time(NULL);                                            \
-      struct tm* locTime = localtime(&curTime);                               \
-      strftime(tStr, 1000, "%T %x ", locTime);                                \
-      /* Write the formatted message to the stream */                         \
-      *lstream << "TID: " << std::this_thread::get_id() << " " << tStr        \
-               << msg_prefix << " "                                           \
-               << iotsitewise::odbc::Logger::GetBaseFileName(__FILE__) << ":"  \
-               << __LINE__ << " " << __FUNCTION__ << ": " << param;           \
-      /* This will trigger the write to stream */                             \
-      lstream = nullptr;                                                      \
-      if (logStream != nullptr) {                                             \
-        /* Restore the stream if it was set */                                \
-        p.get()->SetLogStream(prevStream);                                    \
+    if (logLevel <= IOTSITEWISE_LOG_MAX_LEVEL                                 \
+        && iotsitewise::odbc::Logger::IsLevelEnabled(logLevel)) {             \
+      std::shared_ptr< iotsitewise::odbc::Logger > p =                        \
+          iotsitewise::odbc::Logger::GetLoggerInstance();                     \
+      if (p->GetLogLevel() >= logLevel                                        \
+          && (p->IsEnabled() || p->EnableLog())) {                            \
+        std::ostream* prevStream = p.get()->GetLogStream();                   \
+        if (logStream != nullptr) {                                           \
+          /* Override the stream temporarily */                               \
+          p.get()->SetLogStream(logStream);                                   \
+        }                                                                     \
+        std::unique_ptr< iotsitewise::odbc::LogStream > lstream(              \
+            new iotsitewise::odbc::LogStream(p.get()));                       \
+        std::string msg_prefix;                                               \
+        switch (logLevel) {                                                   \
+          case iotsitewise::odbc::LogLevel::Type::DEBUG_LEVEL:                \
+            msg_prefix = "DEBUG MSG: ";                                       \
+            break;                                                            \
+          case iotsitewise::odbc::LogLevel::Type::INFO_LEVEL:                 \
+            msg_prefix = "INFO MSG: ";                                        \
+            break;                                                            \
+          case iotsitewise::odbc::LogLevel::Type::WARNING_LEVEL:              \
+            msg_prefix = "WARNING MSG: ";                                     \
+            break;                                                            \
+          case iotsitewise::odbc::LogLevel::Type::ERROR_LEVEL:                \
+            msg_prefix = "ERROR MSG: ";                                       \
+            break;                                                            \
+          default:                                                            \
+            msg_prefix = "";                                                  \
+        }                                                                     \
+        char tStr[1000];                                                      \
+        time_t curTime = time(NULL);                                          \
+        struct tm* locTime = localtime(&curTime);                             \
+        strftime(tStr, 1000, "%T %x ", locTime);                              \
+        /* Write the formatted message to the stream */                       \
+        *lstream << "TID: " << std::this_thread::get_id() << " " << tStr      \
+                 << msg_prefix << " "                                         \
+                 << iotsitewise::odbc::Logger::GetBaseFileName(__FILE__)      \
+                 << ":" << __LINE__ << " " << __FUNCTION__ << ": " << param;  \
+        /* This will trigger the write to stream */                           \
+        lstream = nullptr;                                                    \
+        if (logStream != nullptr) {                                           \
+          /* Restore the stream if it was set */                              \
+          p.get()->SetLogStream(prevStream);                                  \
+        }                                                                     \
       }                                                                       \
     }                                                                         \
   }
@@ -161,9 +176,9 @@ class IGNITE_IMPORT_EXPORT LogStream : public std::basic_ostream< char > {
 class Logger {
  public:
   /**
-   * Destructor.
+   * Destructor. Writes the messages still queued.
    */
-  ~Logger() = default;
+  ~Logger();
 
   /**
    * Set the logger's set log level.
@@ -213,6 +228,18 @@ class Logger {
     return logger_;
   }
 
+  /**
+   * Check if messages of a level are logged. It is checked by every log
+   * statement before the logger instance is touched, so it only reads a
+   * copy of the level.
+   * @param level Log level of the message.
+   * @return True, if the level is enabled.
+   */
+  static bool IsLevelEnabled(LogLevel::Type level) {
+    return static_cast< int >(level)
+           <= cachedLogLevel_.load(std::memory_order_relaxed);
+  }
+
   /**
    * Get a file base name without path.
    * @return File base name.
@@ -268,9 +295,37 @@ class Logger {
    */
   void WriteMessage(std::string const& message);
 
+  /**
+   * Write the messages to the log file from a background thread. The
+   * messages are queued by the logging threads and written in batches. It is
+   * reference counted, the writer is started by the first holder and stopped
+   * by the last one, and the queue settings of the first holder are used.
+   * @param queueSize Maximum number of queued messages.
+   * @param dropWhenFull Drop the messages when the queue is full instead of
+   * waiting for the writer.
+   */
+  void StartAsync(size_t queueSize, bool dropWhenFull);
+
+  /**
+   * Release the background writer. The last holder waits for the queued
+   * messages to be written and stops the writer.
+   */
+  void StopAsync();
+
+  /**
+   * Checks if messages are written by the background writer.
+   * @return True, if messages are written by the background writer.
+   */
+  bool IsAsync() const {
+    return isAsync.load();
+  }
+
  private:
   static std::shared_ptr< Logger > logger_;  // a singleton instance
 
+  /** Copy of the log level of the instance, read by IsLevelEnabled. */
+  static std::atomic< int > cachedLogLevel_;
+
   /**
    * Constructor.
    */
@@ -282,6 +337,27 @@ class Logger {
    */
   std::string CreateFileName() const;
 
+  /**
+   * Queue a message for the background writer.
+   * @param message The message to queue.
+   * @return True, if the message is queued or dropped. False, if the
+   * background writer is stopped.
+   */
+  bool QueueMessage(std::string const& message);
+
+  /**
+   * Background writer routine.
+   */
+  void RunAsyncWriter();
+
+  /**
+   * Write the queued messages to the log file.
+   * @param message Buffer of the messages popped.
+   * @param maxCount Maximum number of messages to write.
+   * @return Number of messages written.
+   */
+  size_t WriteQueuedMessages(std::string& message, size_t maxCount);
+
   IGNITE_NO_COPY_ASSIGNMENT(Logger);
 
   /** Mutex for writes synchronization. */
@@ -310,6 +386,42 @@ class Logger {
 
   /** Log file path */
   std::string logFilePath;
+
+  /** Mutex for the background writer start and stop. */
+  std::mutex asyncHoldersMutex;
+
+  /** Number of holders of the background writer. */
+  size_t asyncHolders = 0;
+
+  /** Flag indicating the messages are queued for the background writer. */
+  std::atomic< bool > isAsync{false};
+
+  /** Number of threads queueing a message. */
+  std::atomic< int > asyncProducers{0};
+
+  /** Queued messages. */
+  std::unique_ptr< AsyncLogQueue > asyncQueue;
+
+  /** Drop the messages when the queue is full. */
+  bool asyncDropWhenFull = false;
+
+  /** Number of messages dropped since the last report. */
+  std::atomic< size_t > droppedMessages{0};
+
+  /** Background writer thread. */
+  std::thread asyncWriter;
+
+  /** Mutex for the background writer wake up. */
+  std::mutex asyncMutex;
+
+  /** Condition variable to wake up the background writer. */
+  std::condition_variable asyncCv;
+
+  /** Flag indicating the background writer is waiting for messages. */
+  std::atomic< bool > isWriterSleeping{false};
+
+  /** Flag indicating the background writer is stopping. */
+  bool isAsyncStopping = false;
 };
 
 }  // namespace odbc
@@ -0,0 +1,156 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _IOTSITEWISE_ODBC_META_RESULT_SET_META_CACHE
+#define _IOTSITEWISE_ODBC_META_RESULT_SET_META_CACHE
+
+#include <stdint.h>
+
+#include <chrono>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "iotsitewise/odbc/meta/column_meta.h"
+
+namespace iotsitewise {
+namespace odbc {
+namespace meta {
+/**
+ * Least recently used cache of result set metadata, keyed by normalized SQL
+ * text. It is shared by the statements of a connection.
+ */
+class IGNITE_IMPORT_EXPORT ResultSetMetaCache {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param capacity Max number of entries, 0 disables the cache.
+   * @param ttl Seconds an entry stays valid, 0 keeps entries until evicted.
+   */
+  ResultSetMetaCache(size_t capacity, int32_t ttl);
+
+  /**
+   * Destructor.
+   */
+  ~ResultSetMetaCache() = default;
+
+  /**
+   * Set the cache limits. Cached entries are dropped.
+   *
+   * @param capacity Max number of entries, 0 disables the cache.
+   * @param ttl Seconds an entry stays valid, 0 keeps entries until evicted.
+   */
+  void Configure(size_t capacity, int32_t ttl);
+
+  /**
+   * Look up metadata of a query.
+   *
+   * @param sql SQL query string.
+   * @param meta Found metadata.
+   * @return True if valid metadata is found.
+   */
+  bool Get(const std::string& sql, ColumnMetaVector& meta);
+
+  /**
+   * Save metadata of a query.
+   *
+   * @param sql SQL query string.
+   * @param meta Metadata of the query result set.
+   */
+  void Put(const std::string& sql, const ColumnMetaVector& meta);
+
+  /**
+   * Drop all cached entries.
+   */
+  void Clear();
+
+  /**
+   * Get number of lookups answered from the cache.
+   *
+   * @return Number of hits.
+   */
+  uint64_t GetHits() const;
+
+  /**
+   * Get number of lookups not answered from the cache.
+   *
+   * @return Number of misses.
+   */
+  uint64_t GetMisses() const;
+
+  /**
+   * Get number of cached entries.
+   *
+   * @return Number of entries.
+   */
+  size_t GetSize() const;
+
+  /**
+   * Normalize SQL text so that queries differing only in whitespace share
+   * an entry. Whitespace runs outside of quoted literals and identifiers
+   * are replaced with one space, leading and trailing whitespace and
+   * semicolons are removed.
+   *
+   * @param sql SQL query string.
+   * @return Normalized SQL query string.
+   */
+  static std::string Normalize(const std::string& sql);
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(ResultSetMetaCache);
+
+  /** Clock used for entry expiration. */
+  typedef std::chrono::steady_clock Clock;
+
+  /** Cache entry: key, expiration time and metadata. */
+  struct Entry {
+    std::string key;
+    Clock::time_point expiry;
+    ColumnMetaVector meta;
+  };
+
+  /** Entry list type. */
+  typedef std::list< Entry > EntryList;
+
+  /** Mutex protecting the entries and counters. */
+  mutable std::mutex mutex_;
+
+  /** Max number of entries. */
+  size_t capacity_;
+
+  /** Seconds an entry stays valid. */
+  int32_t ttl_;
+
+  /** Entries, the most recently used first. */
+  EntryList entries_;
+
+  /** Index of the entries. */
+  std::unordered_map< std::string, EntryList::iterator > index_;
+
+  /** Number of hits. */
+  uint64_t hits_;
+
+  /** Number of misses. */
+  uint64_t misses_;
+};
+}  // namespace meta
+}  // namespace odbc
+}  // namespace iotsitewise
+
+#endif  //_IOTSITEWISE_ODBC_META_RESULT_SET_META_CACHE
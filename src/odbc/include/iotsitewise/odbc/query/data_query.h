@@ -21,14 +21,26 @@
 #ifndef _IOTSITEWISE_ODBC_QUERY_DATA_QUERY
 #define _IOTSITEWISE_ODBC_QUERY_DATA_QUERY
 
+#include "iotsitewise/odbc/adaptive_page_size.h"
+#include "iotsitewise/odbc/conversion_plan.h"
+#include "iotsitewise/odbc/decoded_page.h"
 #include "iotsitewise/odbc/iotsitewise_cursor.h"
 #include "iotsitewise/odbc/query/query.h"
+#include "iotsitewise/odbc/query_client.h"
+#include "iotsitewise/odbc/query_result_cache.h"
+#include "iotsitewise/odbc/shared_query_stream.h"
 #include "iotsitewise/odbc/connection.h"
+#include "iotsitewise/odbc/thread_pool.h"
 
+#include <aws/core/utils/Outcome.h>
+#include <aws/iotsitewise/IoTSiteWiseErrors.h>
 #include <aws/iotsitewise/model/ExecuteQueryRequest.h>
 #include <aws/iotsitewise/model/ExecuteQueryResult.h>
 #include <aws/iotsitewise/model/ColumnInfo.h>
 
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include <queue>
 #include <mutex>
 #include <condition_variable>
@@ -43,12 +55,83 @@ namespace odbc {
 class Connection;
 
 namespace query {
+/**
+ * Cancellation state of one query execution. It is shared with the requests
+ * of the execution, which are aborted as soon as the execution is cancelled
+ * or its deadline passes.
+ */
+class IGNITE_IMPORT_EXPORT ExecutionControl {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param timeout Query timeout in seconds, 0 means no timeout.
+   */
+  explicit ExecutionControl(int32_t timeout)
+      : cancelled_(false),
+        hasDeadline_(timeout > 0),
+        deadline_(std::chrono::steady_clock::now()
+                  + std::chrono::seconds(timeout)) {
+  }
+
+  /**
+   * Cancel the execution.
+   */
+  void Cancel() {
+    cancelled_ = true;
+  }
+
+  /**
+   * Check if the deadline of the execution has passed.
+   *
+   * @return True if the execution is timed out.
+   */
+  bool IsTimedOut() const {
+    return hasDeadline_ && std::chrono::steady_clock::now() >= deadline_;
+  }
+
+  /**
+   * Check if the requests of the execution should go on.
+   *
+   * @return True if the execution is neither cancelled nor timed out.
+   */
+  bool ShouldContinue() const {
+    return !cancelled_ && !IsTimedOut();
+  }
+
+  /**
+   * Get the deadline of the execution.
+   *
+   * @return Deadline, the maximum time point if there is no deadline.
+   */
+  std::chrono::steady_clock::time_point GetDeadline() const {
+    return hasDeadline_ ? deadline_
+                        : std::chrono::steady_clock::time_point::max();
+  }
+
+ private:
+  /** Flag indicating the execution is cancelled. */
+  std::atomic< bool > cancelled_;
+
+  /** Flag indicating the execution has a deadline. */
+  const bool hasDeadline_;
+
+  /** Deadline of the execution. */
+  const std::chrono::steady_clock::time_point deadline_;
+};
+
 /**
  * Context for asynchronous fetching data query result.
  */
 class IGNITE_IMPORT_EXPORT DataQueryContext {
  public:
-  DataQueryContext() : isClosing_(false) {
+  DataQueryContext()
+      : capacity_(1),
+        isFetching_(false),
+        hasMorePages_(false),
+        isClosing_(false),
+        rowLimit_(0),
+        rowsFetched_(0) {
   }
 
   ~DataQueryContext() = default;
@@ -59,11 +142,35 @@ class IGNITE_IMPORT_EXPORT DataQueryContext {
   /** condition variable to synchronize threads */
   std::condition_variable cv_;
 
-  /** queue to save query execution outcome objects. */
-  std::queue< Aws::IoTSiteWise::Model::ExecuteQueryOutcome > queue_;
+  /** queue to save the outcomes of the fetched pages. */
+  std::queue< PageOutcome > queue_;
+
+  /** Max number of outcome objects the queue could hold. */
+  size_t capacity_;
+
+  /**
+   * Request for the next page. It is only accessed by the fetching task
+   * while isFetching_ is set.
+   */
+  ExecuteQueryRequest request_;
+
+  /** Flag indicating a page fetching task is scheduled or running. */
+  bool isFetching_;
+
+  /** Flag indicating there are pages left to fetch. */
+  bool hasMorePages_;
 
   /** Flag to indicate if the main thread is exiting or not. */
   bool isClosing_;
+
+  /** Max number of rows to fetch. Zero means no limit. */
+  size_t rowLimit_;
+
+  /** Number of rows fetched so far, including the first page. */
+  size_t rowsFetched_;
+
+  /** Page size of the following requests, null for a fixed page size. */
+  std::unique_ptr< AdaptivePageSize > pageSize_;
 };
 
 /**
@@ -77,9 +184,11 @@ class IGNITE_IMPORT_EXPORT DataQuery : public iotsitewise::odbc::query::Query {
    * @param diag Diagnostics collector.
    * @param connection Associated connection.
    * @param sql SQL query string.
+   * @param prefetchPages Max number of result pages fetched ahead of the
+   * cursor.
    */
   DataQuery(diagnostic::DiagnosableAdapter& diag, Connection& connection,
-            const std::string& sql);
+            const std::string& sql, size_t prefetchPages = 1);
 
   /**
    * Destructor.
@@ -115,6 +224,19 @@ class IGNITE_IMPORT_EXPORT DataQuery : public iotsitewise::odbc::query::Query {
    */
   virtual SqlResult::Type FetchNextRow(app::ColumnBindingMap& columnBindings);
 
+  /**
+   * Fetch next result rows to the arrays bound by the application. The rows
+   * of a page are filled column by column, each bound column array in one
+   * pass.
+   *
+   * @param columnBindings Application buffers to put data to.
+   * @param rowCount Number of rows to fetch.
+   * @param rowResults Operation result of each row.
+   */
+  virtual void FetchNextRows(app::ColumnBindingMap& columnBindings,
+                             SqlUlen rowCount,
+                             std::vector< SqlResult::Type >& rowResults);
+
   /**
    * Get data of the specified column in the result set.
    *
@@ -170,6 +292,48 @@ class IGNITE_IMPORT_EXPORT DataQuery : public iotsitewise::odbc::query::Query {
     return sql_;
   }
 
+  /**
+   * Set query timeout. It applies to the following executions and covers
+   * every request they make.
+   *
+   * @param timeout Query timeout in seconds, 0 means no timeout.
+   */
+  void SetQueryTimeout(int32_t timeout) {
+    queryTimeout_ = timeout;
+  }
+
+  /**
+   * Set max number of rows returned by the following executions. No more
+   * pages are requested once the limit is reached.
+   *
+   * @param maxRows Max number of rows, 0 means no limit.
+   */
+  void SetMaxRows(size_t maxRows) {
+    maxRows_ = maxRows;
+  }
+
+  /**
+   * Set size of the first page requested by the following executions. The
+   * later pages grow while they come back quickly, bounded by the
+   * PageMemoryBudget connection setting.
+   *
+   * @param firstPageSize Rows of the first page, 0 disables adaptive page
+   * sizing and all pages are requested with MaxRowPerPage.
+   */
+  void SetFirstPageSize(size_t firstPageSize) {
+    firstPageSize_ = firstPageSize;
+  }
+
+  /**
+   * Set max number of result pages fetched ahead of the cursor by the
+   * following executions.
+   *
+   * @param prefetchPages Max number of pages, 0 means one page.
+   */
+  void SetPrefetchPages(size_t prefetchPages) {
+    prefetchPages_ = prefetchPages > 0 ? prefetchPages : 1;
+  }
+
  private:
   IGNITE_NO_COPY_ASSIGNMENT(DataQuery);
 
@@ -251,14 +415,65 @@ class IGNITE_IMPORT_EXPORT DataQuery : public iotsitewise::odbc::query::Query {
   SqlResult::Type SwitchCursor();
 
   /**
-   * Record the thread so they could be waited before the main thread ends.
-   * @param thread Thread to be saved.
+   * Move cursor to the next row, switching to the next page if needed.
    *
-   * @return void.
+   * @return Result.
    */
-  void addThreads(std::thread& thread) {
-    threads_.push(std::move(thread));
-  }
+  SqlResult::Type MoveToNextRow();
+
+  /**
+   * Start a new execution and make the request abortable by it.
+   *
+   * @param request Request of the execution.
+   */
+  void StartExecution(ExecuteQueryRequest& request);
+
+  /**
+   * Add the status record for a failed request.
+   *
+   * @param message Error message used when the query is not timed out.
+   */
+  void AddRequestErrorRecord(const std::string& message);
+
+  /**
+   * Schedule fetching the next page on the thread pool.
+   * context_.mutex_ should be held by the caller.
+   */
+  void ScheduleFetch();
+
+  /**
+   * Serve the execution from a cached query result.
+   *
+   * @return Result.
+   */
+  SqlResult::Type MakeRequestExecuteCached();
+
+  /**
+   * Keep the current page for the query result cache. The result is cached
+   * once its last page is recorded.
+   *
+   * @param isLast Flag indicating the page is the last one of the result.
+   */
+  void RecordPage(bool isLast);
+
+  /**
+   * Stop recording pages of an incomplete result.
+   */
+  void StopRecording();
+
+  /**
+   * Serve the execution from the stream of an identical query in flight.
+   *
+   * @return Result.
+   */
+  SqlResult::Type MakeRequestExecuteShared();
+
+  /**
+   * Reset the cursor after a page could not be fetched.
+   *
+   * @return Result.
+   */
+  SqlResult::Type FailCursor();
 
   /** Connection associated with the statement. */
   Connection& connection_;
@@ -276,20 +491,84 @@ class IGNITE_IMPORT_EXPORT DataQuery : public iotsitewise::odbc::query::Query {
   ExecuteQueryRequest request_;
 
   /** Current SW Query Result. */
-  std::shared_ptr< ExecuteQueryResult > result_;
+  std::shared_ptr< const DecodedPage > result_;
+
+  /**
+   * First page fetched by the describe request. It is reused by the next
+   * execution instead of running the query again, if the execution follows
+   * shortly and asks for a page of the same size.
+   */
+  std::shared_ptr< const DecodedPage > describeResult_;
+
+  /** Time the describe request was answered. */
+  std::chrono::steady_clock::time_point describeTime_;
 
   /** Cursor. */
   std::unique_ptr< IoTSiteWiseCursor > cursor_;
 
+  /** Converters of the bound columns, kept across the pages. */
+  ConversionPlan plan_;
+
+  /** Bound column of a bulk fetch. */
+  struct BoundColumn {
+    /** Column index, start from 1. */
+    uint32_t columnIdx;
+
+    /** Application data buffer. */
+    app::ApplicationDataBuffer* buffer;
+  };
+
+  /** Bound columns of the last bulk fetch, in column order. */
+  std::vector< BoundColumn > boundColumns_;
+
+  /** Conversion results of a column of the last bulk fetch. */
+  std::vector< app::ConversionResult::Type > convResults_;
+
   /** IoT SiteWise client. */
-  std::shared_ptr< Aws::IoTSiteWise::IoTSiteWiseClient > client_;
+  std::shared_ptr< QueryClient > client_;
+
+  /** Max number of result pages fetched ahead of the cursor. */
+  size_t prefetchPages_;
+
+  /** Thread pool running the page fetching tasks. */
+  std::shared_ptr< ThreadPool > threadPool_;
+
+  /** Query timeout in seconds, 0 means no timeout. */
+  int32_t queryTimeout_;
+
+  /** Max number of rows returned by the query, 0 means no limit. */
+  size_t maxRows_;
+
+  /** Rows of the first page, 0 disables adaptive page sizing. */
+  size_t firstPageSize_;
+
+  /** Cancellation state of the current execution. */
+  std::shared_ptr< ExecutionControl > control_;
+
+  /** Query result cache key, empty when the cache is disabled. */
+  std::string cacheKey_;
+
+  /** Cached pages the execution is served from. */
+  QueryResultCache::Pages cachedPages_;
+
+  /** Index of the next cached page. */
+  size_t cachedPage_;
+
+  /** Flag indicating the fetched pages are recorded for the cache. */
+  bool isRecording_;
+
+  /** Fetched pages recorded for the cache. */
+  QueryResultCache::Pages recordedPages_;
+
+  /** Estimated size of the recorded pages in bytes. */
+  size_t recordedBytes_;
+
+  /** Page stream shared with identical queries, null if not coalesced. */
+  std::shared_ptr< SharedQueryStream > stream_;
 
   /** Context for asynchornous result fetching. */
   DataQueryContext context_;
 
-  /** Queue for threads. */
-  std::queue< std::thread > threads_;
-
   /** Flag indicating asynchronous fetch is started. */
   bool hasAsyncFetch;
 
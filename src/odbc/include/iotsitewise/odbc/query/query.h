@@ -24,6 +24,7 @@
 #include <stdint.h>
 
 #include <map>
+#include <vector>
 
 #include "iotsitewise/odbc/common_types.h"
 #include "iotsitewise/odbc/diagnostic/diagnosable_adapter.h"
@@ -113,6 +114,29 @@ class Query {
   virtual SqlResult::Type FetchNextRow(
       iotsitewise::odbc::app::ColumnBindingMap& columnBindings) = 0;
 
+  /**
+   * Fetch next result rows to the arrays bound by the application. The
+   * rows are fetched one by one unless the query fills the arrays in bulk.
+   *
+   * @param columnBindings Application buffers to put data to.
+   * @param rowCount Number of rows to fetch.
+   * @param rowResults Operation result of each row.
+   */
+  virtual void FetchNextRows(
+      iotsitewise::odbc::app::ColumnBindingMap& columnBindings,
+      SqlUlen rowCount, std::vector< SqlResult::Type >& rowResults) {
+    rowResults.resize(rowCount);
+    for (SqlUlen i = 0; i < rowCount; ++i) {
+      for (iotsitewise::odbc::app::ColumnBindingMap::iterator it =
+               columnBindings.begin();
+           it != columnBindings.end(); ++it) {
+        it->second.SetElementOffset(i);
+      }
+
+      rowResults[i] = FetchNextRow(columnBindings);
+    }
+  }
+
   /**
    * Get data of the specified column in the result set.
    *
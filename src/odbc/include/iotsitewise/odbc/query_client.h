@@ -0,0 +1,108 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _IOTSITEWISE_ODBC_QUERY_CLIENT
+#define _IOTSITEWISE_ODBC_QUERY_CLIENT
+
+#include <memory>
+
+#include <aws/core/auth/AWSCredentials.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/iotsitewise/IoTSiteWiseClient.h>
+#include <aws/iotsitewise/IoTSiteWiseErrors.h>
+#include <aws/iotsitewise/model/ExecuteQueryRequest.h>
+
+#include "ignite/common/common.h"
+#include "iotsitewise/odbc/decoded_page.h"
+
+namespace iotsitewise {
+namespace odbc {
+/** Outcome of a page request, holding the decoded page on success. */
+typedef Aws::Utils::Outcome< std::shared_ptr< const DecodedPage >,
+                             Aws::IoTSiteWise::IoTSiteWiseError >
+    PageOutcome;
+
+/**
+ * IoT SiteWise client fetching the pages of a query as decoded pages.
+ *
+ * By default a page is deserialized into the SDK model and then decoded.
+ * With raw response decoding, the JSON body of the response is decoded
+ * directly by ResponseDecoder, and only parsed into the SDK model if it has
+ * content the decoder does not handle.
+ */
+class IGNITE_IMPORT_EXPORT QueryClient
+    : public Aws::IoTSiteWise::IoTSiteWiseClient {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param credentials AWS IAM credentials.
+   * @param clientConfiguration AWS client configuration.
+   * @param rawResponseDecoding Decode the response body directly.
+   */
+  QueryClient(const Aws::Auth::AWSCredentials& credentials,
+              const Aws::Client::ClientConfiguration& clientConfiguration,
+              bool rawResponseDecoding = false);
+
+  /**
+   * Constructor.
+   *
+   * @param credentialsProvider Provider of the AWS credentials, asked for
+   * the credentials on every request.
+   * @param clientConfiguration AWS client configuration.
+   * @param rawResponseDecoding Decode the response body directly.
+   */
+  QueryClient(
+      const std::shared_ptr< Aws::Auth::AWSCredentialsProvider >&
+          credentialsProvider,
+      const Aws::Client::ClientConfiguration& clientConfiguration,
+      bool rawResponseDecoding = false);
+
+  /**
+   * Destructor.
+   */
+  virtual ~QueryClient() = default;
+
+  /**
+   * Fetch a page of a query.
+   *
+   * @param request Request.
+   * @return Decoded page or the error.
+   */
+  virtual PageOutcome ExecuteQueryPage(
+      const Aws::IoTSiteWise::Model::ExecuteQueryRequest& request);
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(QueryClient);
+
+  /**
+   * Fetch a page of a query and decode the response body.
+   *
+   * @param request Request.
+   * @return Decoded page or the error.
+   */
+  PageOutcome ExecuteQueryRaw(
+      const Aws::IoTSiteWise::Model::ExecuteQueryRequest& request);
+
+  /** Flag indicating the response body is decoded directly. */
+  const bool rawResponseDecoding_;
+};
+}  // namespace odbc
+}  // namespace iotsitewise
+
+#endif  //_IOTSITEWISE_ODBC_QUERY_CLIENT
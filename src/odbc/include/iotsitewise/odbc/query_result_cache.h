@@ -0,0 +1,152 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _IOTSITEWISE_ODBC_QUERY_RESULT_CACHE
+#define _IOTSITEWISE_ODBC_QUERY_RESULT_CACHE
+
+#include <stdint.h>
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ignite/common/common.h"
+#include "iotsitewise/odbc/decoded_page.h"
+
+namespace iotsitewise {
+namespace odbc {
+/**
+ * Cache of complete query results shared by all connections of the process,
+ * keyed by the credentials identity and the normalized SQL text. Repeated
+ * refreshes of the same query are answered from the cached pages.
+ */
+class IGNITE_IMPORT_EXPORT QueryResultCache {
+ public:
+  /** Pages of a query result. */
+  typedef std::vector< std::shared_ptr< const DecodedPage > > Pages;
+
+  /**
+   * Constructor.
+   */
+  QueryResultCache();
+
+  /**
+   * Destructor.
+   */
+  ~QueryResultCache() = default;
+
+  /**
+   * Get the process-wide cache.
+   *
+   * @return Process-wide cache.
+   */
+  static QueryResultCache& GetInstance();
+
+  /**
+   * Make the key of a query result.
+   *
+   * @param identity Credentials identity of the connection.
+   * @param sql SQL query string.
+   * @return Cache key.
+   */
+  static std::string MakeKey(const std::string& identity,
+                             const std::string& sql);
+
+  /**
+   * Look up a query result.
+   *
+   * @param key Cache key.
+   * @param ttl Seconds a result stays valid for the caller.
+   * @param pages Found pages.
+   * @return True if a fresh result is found.
+   */
+  bool Get(const std::string& key, int32_t ttl, Pages& pages);
+
+  /**
+   * Save a query result. The least recently used results are evicted until
+   * the cache fits the given capacity.
+   *
+   * @param key Cache key.
+   * @param pages Pages of the complete result.
+   * @param bytes Estimated size of the pages in bytes.
+   * @param capacity Bytes the cache may take.
+   */
+  void Put(const std::string& key, const Pages& pages, size_t bytes,
+           size_t capacity);
+
+  /**
+   * Drop all cached results.
+   */
+  void Clear();
+
+  /**
+   * Get number of cached results.
+   *
+   * @return Number of results.
+   */
+  size_t GetSize() const;
+
+  /**
+   * Get estimated size of the cached results.
+   *
+   * @return Size in bytes.
+   */
+  size_t GetBytes() const;
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(QueryResultCache);
+
+  /** Clock used for entry expiration. */
+  typedef std::chrono::steady_clock Clock;
+
+  /** Cache entry: key, creation time, size and pages. */
+  struct Entry {
+    std::string key;
+    Clock::time_point created;
+    size_t bytes;
+    Pages pages;
+  };
+
+  /** Entry list type. */
+  typedef std::list< Entry > EntryList;
+
+  /**
+   * Remove an entry.
+   *
+   * @param it Entry to remove.
+   */
+  void Erase(EntryList::iterator it);
+
+  /** Mutex protecting the entries. */
+  mutable std::mutex mutex_;
+
+  /** Entries, the most recently used first. */
+  EntryList entries_;
+
+  /** Entries by key. */
+  std::unordered_map< std::string, EntryList::iterator > index_;
+
+  /** Estimated size of the cached results in bytes. */
+  size_t bytes_;
+};
+}  // namespace odbc
+}  // namespace iotsitewise
+
+#endif  //_IOTSITEWISE_ODBC_QUERY_RESULT_CACHE
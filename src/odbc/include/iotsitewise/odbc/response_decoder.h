@@ -0,0 +1,53 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _IOTSITEWISE_ODBC_RESPONSE_DECODER
+#define _IOTSITEWISE_ODBC_RESPONSE_DECODER
+
+#include <stddef.h>
+
+#include <memory>
+
+#include "ignite/common/common.h"
+#include "iotsitewise/odbc/decoded_page.h"
+
+namespace iotsitewise {
+namespace odbc {
+/**
+ * Decoder of the JSON body of an ExecuteQuery response.
+ *
+ * The body is read in a single pass. The values of the numeric, boolean and
+ * timestamp columns are decoded from the body straight into the typed arrays
+ * of the page, so no Datum or string is created for them. Only the values of
+ * the other columns are stored in the rows of the page.
+ */
+class IGNITE_IMPORT_EXPORT ResponseDecoder {
+ public:
+  /**
+   * Decode the body of an ExecuteQuery response.
+   *
+   * @param body Response body.
+   * @param size Size of the body in bytes.
+   * @return Page, or nullptr if the body is malformed or has a value the
+   *     decoder does not handle. The body should then be parsed into the
+   *     SDK model.
+   */
+  static std::shared_ptr< DecodedPage > Decode(const char* body, size_t size);
+};
+}  // namespace odbc
+}  // namespace iotsitewise
+
+#endif  //_IOTSITEWISE_ODBC_RESPONSE_DECODER
@@ -0,0 +1,218 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _IOTSITEWISE_ODBC_SHARED_QUERY_STREAM
+#define _IOTSITEWISE_ODBC_SHARED_QUERY_STREAM
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <aws/iotsitewise/model/ExecuteQueryRequest.h>
+
+#include "ignite/common/common.h"
+#include "iotsitewise/odbc/decoded_page.h"
+#include "iotsitewise/odbc/query_client.h"
+#include "iotsitewise/odbc/thread_pool.h"
+
+namespace iotsitewise {
+namespace odbc {
+/**
+ * Result pages of one query execution shared by the identical executions
+ * running at the same time. The first subscriber fetches the first page and
+ * starts the stream, the following pages are fetched by the thread pool and
+ * each subscriber reads them at its own pace.
+ *
+ * Executions join a stream while it is still fetching and none of its pages
+ * has been released, so every subscriber sees the whole result. Pages are
+ * fetched ahead of the leading subscriber and released once all subscribers
+ * have passed them. Fetching stops when the last subscriber leaves.
+ */
+class IGNITE_IMPORT_EXPORT SharedQueryStream
+    : public std::enable_shared_from_this< SharedQueryStream > {
+ public:
+  /** Page of the query result. */
+  typedef std::shared_ptr< const DecodedPage > Page;
+
+  /**
+   * Constructor.
+   */
+  SharedQueryStream();
+
+  /**
+   * Destructor.
+   */
+  ~SharedQueryStream() = default;
+
+  /**
+   * Join the stream of an identical query in flight or create a new one.
+   *
+   * @param key Query key, see QueryResultCache::MakeKey.
+   * @param subscriber Subscriber joining the stream.
+   * @param isNew Set to true if a new stream is created. The subscriber
+   * then has to fetch the first page and call Start or Fail.
+   * @return Stream.
+   */
+  static std::shared_ptr< SharedQueryStream > Acquire(const std::string& key,
+                                                      const void* subscriber,
+                                                      bool& isNew);
+
+  /**
+   * Publish the first page and start fetching the following ones.
+   *
+   * @param subscriber Subscriber that fetched the first page. Its next page
+   * is the second one.
+   * @param client IoT SiteWise client.
+   * @param pool Thread pool running the page fetching tasks.
+   * @param request Request of the execution, its next token is set from
+   * the first page.
+   * @param firstPage First page of the result.
+   * @param capacity Max number of pages fetched ahead of the leading
+   * subscriber.
+   */
+  void Start(const void* subscriber,
+             std::shared_ptr< QueryClient > client,
+             ThreadPool* pool,
+             const Aws::IoTSiteWise::Model::ExecuteQueryRequest& request,
+             const Page& firstPage, size_t capacity);
+
+  /**
+   * Fail the stream before its first page is published.
+   *
+   * @param error Error message reported to the other subscribers.
+   */
+  void Fail(const std::string& error);
+
+  /**
+   * Wait for the next page of a subscriber.
+   *
+   * @param subscriber Subscriber.
+   * @param deadline Time point to stop waiting at.
+   * @param page Next page.
+   * @param error Error message if no page is returned.
+   * @return True if the page is returned.
+   */
+  bool Next(const void* subscriber,
+            std::chrono::steady_clock::time_point deadline, Page& page,
+            std::string& error);
+
+  /**
+   * Leave the stream. Fetching is stopped when the last subscriber leaves.
+   *
+   * @param subscriber Subscriber.
+   */
+  void Leave(const void* subscriber);
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(SharedQueryStream);
+
+  /**
+   * Add a subscriber if the stream still holds its whole result.
+   *
+   * @param subscriber Subscriber.
+   * @return True if the subscriber is added.
+   */
+  bool Join(const void* subscriber);
+
+  /**
+   * Fetch one page. It is executed by a thread pool worker.
+   */
+  void FetchOnePage();
+
+  /**
+   * Schedule fetching the next page if fewer than capacity_ pages are
+   * fetched ahead of the leading subscriber. mutex_ should be held by the
+   * caller.
+   */
+  void ScheduleFetch();
+
+  /**
+   * Release the pages all subscribers have passed. The first page is kept
+   * for the executions joining later. mutex_ should be held by the caller.
+   */
+  void ReleasePages();
+
+  /** Mutex protecting the registry. */
+  static std::mutex registryMutex_;
+
+  /** Streams by query key. */
+  static std::unordered_map< std::string, std::weak_ptr< SharedQueryStream > >
+      registry_;
+
+  /** Mutex protecting the stream state. */
+  std::mutex mutex_;
+
+  /** Condition variable to wake up the waiting subscribers. */
+  std::condition_variable cv_;
+
+  /** Fetched pages, the released ones are null. */
+  std::vector< Page > pages_;
+
+  /** Index of the next page of each subscriber. */
+  std::map< const void*, size_t > positions_;
+
+  /**
+   * Index of the first page not released yet. The pages from the second one
+   * up to it are released.
+   */
+  size_t released_;
+
+  /** Max number of pages fetched ahead of the leading subscriber. */
+  size_t capacity_;
+
+  /** Flag indicating the first page is published or the stream failed. */
+  bool isStarted_;
+
+  /** Flag indicating there are pages left to fetch. */
+  bool hasMorePages_;
+
+  /** Flag indicating a page fetching task is scheduled or running. */
+  bool isFetching_;
+
+  /** Flag indicating the stream failed. */
+  bool isFailed_;
+
+  /** Error message of the failed stream. */
+  std::string error_;
+
+  /** Flag indicating all subscribers left, polled by the request in flight. */
+  std::atomic< bool > isCancelled_;
+
+  /**
+   * Request for the next page. It is only accessed by the fetching task
+   * while isFetching_ is set.
+   */
+  Aws::IoTSiteWise::Model::ExecuteQueryRequest request_;
+
+  /** IoT SiteWise client. */
+  std::shared_ptr< QueryClient > client_;
+
+  /**
+   * Thread pool running the page fetching tasks. It is kept alive by the
+   * subscribers, and the last one waits for the running task on leaving.
+   */
+  ThreadPool* pool_;
+};
+}  // namespace odbc
+}  // namespace iotsitewise
+
+#endif  //_IOTSITEWISE_ODBC_SHARED_QUERY_STREAM
@@ -25,6 +25,7 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "iotsitewise/odbc/app/application_data_buffer.h"
 #include "iotsitewise/odbc/common_types.h"
@@ -597,6 +598,12 @@ class IGNITE_IMPORT_EXPORT Statement : public diagnostic::DiagnosableAdapter {
    */
   SqlResult::Type InternalFetchRow();
 
+  /**
+   * Apply the bind offset and the bind type of the statement to the bound
+   * columns before a fetch.
+   */
+  void PrepareColumnBindings();
+
   /**
    * Get number of columns in the result set.
    *
@@ -737,6 +744,13 @@ class IGNITE_IMPORT_EXPORT Statement : public diagnostic::DiagnosableAdapter {
 
   SqlResult::Type InternalSetCursorName(SQLWCHAR* name, SQLSMALLINT nameLen);
 
+  /**
+   * Get number of result pages fetched ahead of the cursor.
+   *
+   * @return Statement attribute value if set, connection setting otherwise.
+   */
+  SqlUlen GetPrefetchPages() const;
+
   /**
    * Convert SQLRESULT to SQL_ROW_RESULT.
    *
@@ -762,6 +776,12 @@ class IGNITE_IMPORT_EXPORT Statement : public diagnostic::DiagnosableAdapter {
   /** Offset added to pointers to change binding of column data. */
   SqlUlen* columnBindOffset;
 
+  /**
+   * Binding orientation, SQL_BIND_BY_COLUMN or the size of the structure
+   * holding a row for row-wise binding.
+   */
+  SqlUlen rowBindType;
+
   /** Offset used to iterate through a cell for variable-length data. */
   SqlLen cellOffset;
 
@@ -774,6 +794,27 @@ class IGNITE_IMPORT_EXPORT Statement : public diagnostic::DiagnosableAdapter {
   /** Rowset size. */
   SqlUlen rowsetSize;
 
+  /** Results of the rows of the last fetch. */
+  std::vector< SqlResult::Type > rowResults;
+
+  /**
+   * Number of result pages fetched ahead of the cursor. Zero means the
+   * connection setting is used.
+   */
+  SqlUlen prefetchPages;
+
+  /** Query timeout in seconds. Zero means no timeout. */
+  SqlUlen queryTimeout;
+
+  /** Max number of rows returned by a query. Zero means no limit. */
+  SqlUlen maxRows;
+
+  /**
+   * Number of rows of the first result page. Zero means all pages are
+   * requested with the same size.
+   */
+  SqlUlen firstPageSize;
+
   /** implicitly allocated ARD */
   std::unique_ptr< Descriptor > ardi;
 
@@ -51,6 +51,24 @@
 // Internal SQL connection attribute to set log level
 #define SQL_ATTR_SWLOG_DEBUG 65536
 
+// Driver-specific SQL statement attribute to set the number of result pages
+// fetched ahead of the cursor
+#define SQL_ATTR_SWPREFETCH_PAGES 65537
+
+// Driver-specific read-only SQL connection attributes to get the number of
+// result set metadata cache hits and misses
+#define SQL_ATTR_SWMETADATA_CACHE_HITS 65538
+#define SQL_ATTR_SWMETADATA_CACHE_MISSES 65539
+
+// Driver-specific SQL statement attribute to set the number of rows of the
+// first result page, 0 requests every page with the same size
+#define SQL_ATTR_SWFIRST_PAGE_SIZE 65540
+
+// Driver-specific read-only SQL connection attributes to get the number of
+// query executions answered and not answered by the query result cache
+#define SQL_ATTR_SWRESULT_CACHE_HITS 65541
+#define SQL_ATTR_SWRESULT_CACHE_MISSES 65542
+
 // Internal flag to use database as catalog or schema
 // true if databases are reported as catalog, false if databases are reported as
 // schema
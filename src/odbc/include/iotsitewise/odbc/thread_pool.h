@@ -0,0 +1,125 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _IOTSITEWISE_ODBC_THREAD_POOL
+#define _IOTSITEWISE_ODBC_THREAD_POOL
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ignite/common/common.h"
+
+/** Default number of worker threads in the process-wide pool. */
+#define DEFAULT_THREAD_POOL_SIZE 16
+
+namespace iotsitewise {
+namespace odbc {
+/**
+ * Bounded pool of worker threads shared by all environments, connections
+ * and statements of the process.
+ *
+ * Tasks are queued per owner (usually a connection) and the workers take
+ * tasks from the owners in round-robin order, so one connection with many
+ * busy statements could not starve the others.
+ */
+class IGNITE_IMPORT_EXPORT ThreadPool {
+ public:
+  /** Task type. */
+  typedef std::function< void() > Task;
+
+  /**
+   * Constructor.
+   *
+   * @param size Number of worker threads.
+   */
+  explicit ThreadPool(size_t size);
+
+  /**
+   * Destructor. Waits for the queued tasks to finish.
+   */
+  ~ThreadPool();
+
+  /**
+   * Get the process-wide pool. The pool is created on the first call and
+   * destroyed when the last holder releases it. Its size is read from the
+   * environment variable SW_THREAD_POOL_SIZE on creation.
+   *
+   * @return Process-wide pool.
+   */
+  static std::shared_ptr< ThreadPool > GetInstance();
+
+  /**
+   * Schedule a task.
+   *
+   * @param owner Owner of the task, used for fairness between owners.
+   * @param task Task to be executed by a worker thread.
+   */
+  void Submit(const void* owner, Task task);
+
+  /**
+   * Get number of worker threads.
+   *
+   * @return Number of worker threads.
+   */
+  size_t GetSize() const {
+    return size_;
+  }
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(ThreadPool);
+
+  /**
+   * Worker thread routine.
+   */
+  void Run();
+
+  /** Number of worker threads. */
+  const size_t size_;
+
+  /** Worker threads. They are started on the first submitted task. */
+  std::vector< std::thread > workers_;
+
+  /** Mutex protecting the queues. */
+  std::mutex mutex_;
+
+  /** Condition variable to wake up the workers. */
+  std::condition_variable cv_;
+
+  /** Pending tasks of each owner. */
+  std::map< const void*, std::deque< Task > > tasks_;
+
+  /** Owners with pending tasks, in the order they are served. */
+  std::deque< const void* > owners_;
+
+  /** Flag indicating the pool is stopping. */
+  bool isStopping_;
+
+  /** Mutex for the process-wide pool creation. */
+  static std::mutex instanceMutex_;
+
+  /** Process-wide pool. */
+  static std::weak_ptr< ThreadPool > instance_;
+};
+}  // namespace odbc
+}  // namespace iotsitewise
+
+#endif  //_IOTSITEWISE_ODBC_THREAD_POOL
@@ -89,6 +89,33 @@ IGNITE_IMPORT_EXPORT size_t
 CopyUtf8StringToSqlWcharString(const char* inBuffer, SQLWCHAR* outBuffer,
                                size_t outBufferLenBytes, bool& isTruncated);
 
+/**
+ * Transcode utf-8 string to SQLWCHAR buffer in a single pass. The length of
+ * the whole string is counted while copying, so it is not decoded twice.
+ * Runs of ASCII characters are copied a word at a time. The result is null
+ * terminated, possibly truncated, and a character is never split. An invalid
+ * utf-8 byte is replaced with U+FFFD.
+ * @param inBuffer UTF-8 string to copy data from.
+ * @param inBufferLenBytes Length of the input string, in bytes.
+ * @param outBuffer SQLWCHAR buffer to copy data to, may be nullptr.
+ * @param outBufferLenBytes Length of the output buffer, in bytes.
+ * @param bytesRead Number of bytes of the input string copied.
+ * @param bytesWritten Number of bytes copied, excluding the null character.
+ * @return Length of the whole string as SQLWCHAR, in bytes.
+ */
+IGNITE_IMPORT_EXPORT size_t TranscodeUtf8ToSqlWchar(
+    const char* inBuffer, size_t inBufferLenBytes, SQLWCHAR* outBuffer,
+    size_t outBufferLenBytes, size_t& bytesRead, size_t& bytesWritten);
+
+/**
+ * Count the characters of a utf-8 string.
+ * @param inBuffer UTF-8 string.
+ * @param inBufferLenBytes Length of the string, in bytes.
+ * @return Number of characters, an invalid byte counts as one.
+ */
+IGNITE_IMPORT_EXPORT size_t CountUtf8Chars(const char* inBuffer,
+                                           size_t inBufferLenBytes);
+
 /**
  * Copy string to buffer of the specific length.
  * @param str String to copy data from.
@@ -201,6 +228,14 @@ IGNITE_IMPORT_EXPORT std::vector< SQLWCHAR > ToWCHARVector(const char* value);
  */
 IGNITE_IMPORT_EXPORT std::string HexDump(const void* data, size_t count);
 
+/**
+ * Get the SHA-256 digest of a string, so secrets could be compared without
+ * being kept.
+ * @param value String to digest.
+ * @return Digest in hex form.
+ */
+IGNITE_IMPORT_EXPORT std::string Sha256Hex(const std::string& value);
+
 /**
  * Trims leading space from a string.
  * @param s string to be trimmed
@@ -252,6 +287,48 @@ IGNITE_IMPORT_EXPORT int StringToInt(const std::string& s, size_t* idx = 0,
 IGNITE_IMPORT_EXPORT long StringToLong(const std::string& s, size_t* idx = 0,
                                        int base = 10);
 
+/**
+ * Parses a decimal number to double. The decimal point is always '.', so the
+ * parsing does not depend on the locale, and the result is the double
+ * closest to the number. No exception is thrown.
+ * @param str number string, it may be "inf" or "nan" as accepted by strtod
+ * @param len length of the string
+ * @param value parsed value
+ *
+ * @return true if the whole string is a number within the range of double,
+ * false otherwise
+ */
+IGNITE_IMPORT_EXPORT bool ParseDouble(const char* str, size_t len,
+                                      double& value);
+
+/**
+ * Parses a decimal integer with an optional sign to int32_t. No exception is
+ * thrown.
+ * @param str number string
+ * @param len length of the string
+ * @param value parsed value
+ *
+ * @return true if the whole string is an integer within the range of
+ * int32_t, false otherwise
+ */
+IGNITE_IMPORT_EXPORT bool ParseInt32(const char* str, size_t len,
+                                     int32_t& value);
+
+/**
+ * Parses a UTC timestamp formatted as "yyyy-mm-dd hh:mm:ss" with an optional
+ * fraction of 1 to 9 digits. The fields are read at fixed positions, so the
+ * parsing does not depend on the locale.
+ * @param str timestamp string
+ * @param len length of the string
+ * @param seconds number of seconds since 00:00 hours, Jan 1, 1970 UTC
+ * @param fractionNs fractional second component in nanoseconds
+ *
+ * @return true if the string has the format, false otherwise
+ */
+IGNITE_IMPORT_EXPORT bool ParseUtcTimestamp(const char* str, size_t len,
+                                            int64_t& seconds,
+                                            int32_t& fractionNs);
+
 /**
  * Checks if an environment variable is set to true. Case insensitive.
  * @param envVar Environment variable name
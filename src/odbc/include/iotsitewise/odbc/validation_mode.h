@@ -0,0 +1,62 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+#ifndef _IOTSITEWISE_ODBC_VALIDATION_MODE
+#define _IOTSITEWISE_ODBC_VALIDATION_MODE
+
+#include <string>
+#include <ignite/common/common.h>
+
+namespace iotsitewise {
+namespace odbc {
+/** Connection validation mode enum. */
+struct IGNITE_IMPORT_EXPORT ValidationMode {
+  enum class Type {
+    /** Probe query fetching a page of table names on every connect. */
+    FULL,
+
+    /** Probe query fetching a single row on every connect. */
+    LIGHT,
+
+    /** Single row probe query once per credentials in the process. */
+    ONCE,
+
+    /** No probe query, errors are reported by the first statement. */
+    LAZY,
+
+    UNKNOWN
+  };
+
+  /**
+   * Convert validation mode from string.
+   *
+   * @param val String value.
+   * @param dflt Default value to return on error.
+   * @return Corresponding enum value.
+   */
+  static Type FromString(const std::string& val, Type dflt = Type::UNKNOWN);
+
+  /**
+   * Convert validation mode to string.
+   *
+   * @param val Value to convert.
+   * @return String value.
+   */
+  static std::string ToString(Type val);
+};
+}  // namespace odbc
+}  // namespace iotsitewise
+
+#endif  //_IOTSITEWISE_ODBC_VALIDATION_MODE
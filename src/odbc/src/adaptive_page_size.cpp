@@ -0,0 +1,69 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "iotsitewise/odbc/adaptive_page_size.h"
+
+#include <algorithm>
+
+#include "iotsitewise/odbc/log.h"
+
+namespace iotsitewise {
+namespace odbc {
+AdaptivePageSize::AdaptivePageSize(int32_t firstPageSize,
+                                   int32_t maxPageSize, size_t memoryBudget,
+                                   size_t pages, int64_t targetLatency)
+    : pageSize_(1),
+      maxPageSize_(maxPageSize > 0 ? maxPageSize : ADAPTIVE_PAGE_SIZE_LIMIT),
+      pageBudget_(memoryBudget / (pages > 0 ? pages : 1)),
+      targetLatency_(targetLatency),
+      rowBytes_(0) {
+  pageSize_ = std::max(1, std::min(firstPageSize, maxPageSize_));
+}
+
+void AdaptivePageSize::Update(size_t rows, size_t bytes, int64_t latency) {
+  if (rows == 0) {
+    return;
+  }
+
+  size_t rowBytes = std::max< size_t >(bytes / rows, 1);
+  // smooth the row size, as the rows of a result set are alike
+  rowBytes_ = rowBytes_ == 0 ? rowBytes : (rowBytes_ * 3 + rowBytes) / 4;
+
+  int64_t pageSize = pageSize_;
+  if (latency < targetLatency_) {
+    // a full page means the service could send more rows at once
+    if (rows >= static_cast< size_t >(pageSize_)) {
+      pageSize *= 2;
+    }
+  } else if (latency > targetLatency_ * 2) {
+    pageSize /= 2;
+  }
+
+  int64_t memoryLimit = static_cast< int64_t >(
+      std::max< size_t >(pageBudget_ / rowBytes_, 1));
+  pageSize = std::min(pageSize, memoryLimit);
+  pageSize = std::min(pageSize, static_cast< int64_t >(maxPageSize_));
+  pageSize = std::max(pageSize, static_cast< int64_t >(1));
+
+  if (pageSize != pageSize_) {
+    LOG_DEBUG_MSG("Page size is changed from "
+                  << pageSize_ << " to " << pageSize << ", latency "
+                  << latency << " ms, " << rowBytes_ << " bytes per row");
+    pageSize_ = static_cast< int32_t >(pageSize);
+  }
+}
+}  // namespace odbc
+}  // namespace iotsitewise
@@ -21,8 +21,6 @@
 #include "iotsitewise/odbc/app/application_data_buffer.h"
 
 #include <algorithm>
-#include <codecvt>
-#include <locale>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -37,6 +35,26 @@ namespace odbc {
 namespace app {
 using namespace type_traits;
 
+namespace {
+/**
+ * Get the length of a utf-8 string in the output character type.
+ *
+ * @param str UTF-8 string.
+ * @param len Length of the string, in bytes.
+ * @return Length in bytes, excluding the null character.
+ */
+template < typename OutCharT >
+size_t GetStrLenInBytes(const char* str, size_t len) {
+  if (sizeof(OutCharT) != 1) {
+    size_t bytesRead = 0;
+    size_t bytesWritten = 0;
+    return utility::TranscodeUtf8ToSqlWchar(str, len, nullptr, 0, bytesRead,
+                                            bytesWritten);
+  }
+  return ANSI_STRING_ONLY ? len : utility::CountUtf8Chars(str, len);
+}
+}  // namespace
+
 ApplicationDataBuffer::ApplicationDataBuffer()
     : type(type_traits::OdbcNativeType::AI_UNSUPPORTED),
       buffer(0),
@@ -44,7 +62,8 @@ ApplicationDataBuffer::ApplicationDataBuffer()
       reslen(0),
       byteOffset(0),
       cellOffset(-1),
-      elementOffset(0) {
+      elementOffset(0),
+      bindType(SQL_BIND_BY_COLUMN) {
   // No-op.
 }
 
@@ -57,7 +76,8 @@ ApplicationDataBuffer::ApplicationDataBuffer(
       reslen(reslen),
       byteOffset(0),
       cellOffset(-1),
-      elementOffset(0) {
+      elementOffset(0),
+      bindType(SQL_BIND_BY_COLUMN) {
   // No-op.
 }
 
@@ -68,7 +88,8 @@ ApplicationDataBuffer::ApplicationDataBuffer(const ApplicationDataBuffer& other)
       reslen(other.reslen),
       byteOffset(other.byteOffset),
       cellOffset(other.cellOffset),
-      elementOffset(other.elementOffset) {
+      elementOffset(other.elementOffset),
+      bindType(other.bindType) {
   // No-op.
 }
 
@@ -85,6 +106,7 @@ ApplicationDataBuffer& ApplicationDataBuffer::operator=(
   byteOffset = other.byteOffset;
   cellOffset = other.cellOffset;
   elementOffset = other.elementOffset;
+  bindType = other.bindType;
 
   return *this;
 }
@@ -260,23 +282,16 @@ ConversionResult::Type ApplicationDataBuffer::PutStrToStrBuffer(
   LOG_DEBUG_MSG("inCharSize is " << inCharSize << ", outCharSize is "
                                  << outCharSize << ", buflen is " << buflen);
 
-  size_t bytesRequired = 0;
-  if (ANSI_STRING_ONLY) {
-    bytesRequired = value.length() * outCharSize;
-  } else {
-    thread_local std::wstring_convert<std::codecvt_utf8<wchar_t >, wchar_t>
-      converter;
-    std::wstring inString = converter.from_bytes(value.c_str());
-    bytesRequired = inString.length() * outCharSize;
-  }
-
+  const char* inStr = reinterpret_cast< const char* >(value.c_str());
+  size_t inLen = value.length() * inCharSize;
   SqlLen* resLenPtr = GetResLen();
   void* dataPtr = GetData();
 
   if (!dataPtr) {
     // Provide the total bytes required for the field.
     if (resLenPtr) {
-      *resLenPtr = bytesRequired;
+      *resLenPtr = static_cast< SqlLen >(
+          GetStrLenInBytes< OutCharT >(inStr, inLen));
     }
     return ConversionResult::Type::AI_SUCCESS;
   }
@@ -292,17 +307,28 @@ ConversionResult::Type ApplicationDataBuffer::PutStrToStrBuffer(
     return ConversionResult::Type::AI_NO_DATA;
   }
 
+  const char* inStrAtOffset = inStr + inCharIndex * inCharSize;
+  size_t inLenAtOffset = inLen - inCharIndex * inCharSize;
+  size_t outLen = buflen > 0 ? static_cast< size_t >(buflen) : 0;
   size_t bytesWritten = 0;
+  size_t bytesRead = 0;
+  // Bytes required for the data from the cell offset.
+  size_t bytesRequired = 0;
   bool isTruncated = false;
   if (inCharSize == 1) {
     if (outCharSize == 2 || outCharSize == 4) {
-      bytesWritten = utility::CopyUtf8StringToSqlWcharString(
-          reinterpret_cast< const char* >(value.c_str() + inCharIndex),
-          reinterpret_cast< SQLWCHAR* >(dataPtr), buflen, isTruncated);
+      // the length is counted in the same pass as the copy
+      bytesRequired = utility::TranscodeUtf8ToSqlWchar(
+          inStrAtOffset, inLenAtOffset, reinterpret_cast< SQLWCHAR* >(dataPtr),
+          outLen, bytesRead, bytesWritten);
+      isTruncated = bytesRead < inLenAtOffset;
     } else if (sizeof(OutCharT) == 1) {
       bytesWritten = utility::CopyUtf8StringToSqlCharString(
-          reinterpret_cast< const char* >(value.c_str() + inCharIndex),
-          reinterpret_cast< SQLCHAR* >(dataPtr), buflen, isTruncated);
+          inStrAtOffset, reinterpret_cast< SQLCHAR* >(dataPtr), outLen,
+          isTruncated);
+      bytesRequired = GetStrLenInBytes< OutCharT >(inStrAtOffset,
+                                                   inLenAtOffset);
+      bytesRead = bytesWritten;
     } else {
       LOG_ERROR_MSG("Unexpected conversion from UTF8 string.");
       assert(false);
@@ -315,15 +341,22 @@ ConversionResult::Type ApplicationDataBuffer::PutStrToStrBuffer(
   }
 
   written = static_cast< SqlLen >(bytesWritten);
-  LOG_DEBUG_MSG("written is " << written);
+  LOG_DEBUG_MSG("written is " << written << ", bytesRequired is "
+                              << bytesRequired);
 
-  SqlLen totalBytesWritten = (currentCellOffset / inCharSize) * outCharSize + bytesWritten;
   // If all data was successfully returned to the buffer, resLenPtr receives the total
   // number of bytes in the cell, in size outCharSize. If data is being retrieved in parts,
   // resLenPtr will receive the remaining required data, gradually decreasing in length as
   // more calls with the same column are made.
-  SqlLen remainingBytesRequired = bytesRequired - totalBytesWritten > 0 ?
-    static_cast<SqlLen>(bytesRequired - totalBytesWritten) : bytesRequired;
+  SqlLen remainingBytesRequired = 0;
+  if (bytesRequired > bytesWritten) {
+    remainingBytesRequired = static_cast< SqlLen >(bytesRequired - bytesWritten);
+  } else if (inCharIndex == 0) {
+    remainingBytesRequired = static_cast< SqlLen >(bytesRequired);
+  } else {
+    remainingBytesRequired =
+        static_cast< SqlLen >(GetStrLenInBytes< OutCharT >(inStr, inLen));
+  }
   LOG_DEBUG_MSG("remainingBytesRequired is " << remainingBytesRequired);
 
   if (resLenPtr) {
@@ -331,8 +364,7 @@ ConversionResult::Type ApplicationDataBuffer::PutStrToStrBuffer(
   }
 
   if (cellOffset >= 0) {
-    size_t numCharsWritten = bytesWritten / outCharSize;
-    SetCellOffset(cellOffset + numCharsWritten * inCharSize);
+    SetCellOffset(cellOffset + bytesRead);
   }
 
   if (isTruncated) {
@@ -1344,19 +1376,19 @@ double ApplicationDataBuffer::GetDouble() const {
 }
 
 const void* ApplicationDataBuffer::GetData() const {
-  return ApplyOffset(buffer, GetElementSize());
+  return ApplyOffset(buffer, GetDataStride());
 }
 
 const SqlLen* ApplicationDataBuffer::GetResLen() const {
-  return ApplyOffset(reslen, sizeof(*reslen));
+  return ApplyOffset(reslen, GetResLenStride());
 }
 
 void* ApplicationDataBuffer::GetData() {
-  return ApplyOffset(buffer, GetElementSize());
+  return ApplyOffset(buffer, GetDataStride());
 }
 
 SqlLen* ApplicationDataBuffer::GetResLen() {
-  return ApplyOffset(reslen, sizeof(*reslen));
+  return ApplyOffset(reslen, GetResLenStride());
 }
 
 template < typename T >
@@ -1997,6 +2029,20 @@ SqlLen ApplicationDataBuffer::GetElementSize() const {
   return 0;
 }
 
+SqlLen ApplicationDataBuffer::GetDataStride() const {
+  if (bindType != SQL_BIND_BY_COLUMN) {
+    return static_cast< SqlLen >(bindType);
+  }
+  return GetElementSize();
+}
+
+SqlLen ApplicationDataBuffer::GetResLenStride() const {
+  if (bindType != SQL_BIND_BY_COLUMN) {
+    return static_cast< SqlLen >(bindType);
+  }
+  return static_cast< SqlLen >(sizeof(*reslen));
+}
+
 SqlLen ApplicationDataBuffer::GetInputSize() const {
   LOG_DEBUG_MSG("GetInputSize is called");
   if (!IsDataAtExec()) {
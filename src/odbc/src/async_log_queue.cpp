@@ -0,0 +1,89 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "iotsitewise/odbc/async_log_queue.h"
+
+#include <stdint.h>
+
+namespace iotsitewise {
+namespace odbc {
+namespace {
+/**
+ * Round a capacity up to a power of two.
+ *
+ * @param capacity Capacity.
+ * @return Power of two not less than the capacity, at least 2.
+ */
+size_t RoundUpCapacity(size_t capacity) {
+  size_t rounded = 2;
+  while (rounded < capacity && rounded <= SIZE_MAX / 2) {
+    rounded <<= 1;
+  }
+  return rounded;
+}
+}  // namespace
+
+AsyncLogQueue::AsyncLogQueue(size_t capacity)
+    : cells_(new Cell[RoundUpCapacity(capacity)]),
+      mask_(RoundUpCapacity(capacity) - 1),
+      enqueuePos_(0),
+      dequeuePos_(0) {
+  for (size_t i = 0; i <= mask_; i++) {
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+bool AsyncLogQueue::TryPush(std::string& message) {
+  size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+  for (;;) {
+    Cell& cell = cells_[pos & mask_];
+    size_t seq = cell.sequence.load(std::memory_order_acquire);
+    intptr_t diff = static_cast< intptr_t >(seq) - static_cast< intptr_t >(pos);
+    if (diff == 0) {
+      // the cell is free for this position, claim it
+      if (enqueuePos_.compare_exchange_weak(pos, pos + 1,
+                                            std::memory_order_relaxed)) {
+        cell.message.swap(message);
+        cell.sequence.store(pos + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (diff < 0) {
+      // the cell still holds the message of the previous round
+      return false;
+    } else {
+      // another producer has claimed the position
+      pos = enqueuePos_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+bool AsyncLogQueue::TryPop(std::string& message) {
+  size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+  Cell& cell = cells_[pos & mask_];
+  size_t seq = cell.sequence.load(std::memory_order_acquire);
+  if (seq != pos + 1) {
+    return false;
+  }
+
+  dequeuePos_.store(pos + 1, std::memory_order_relaxed);
+  message.swap(cell.message);
+  // do not keep the buffer of the message in the cell
+  std::string().swap(cell.message);
+  cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+  return true;
+}
+}  // namespace odbc
+}  // namespace iotsitewise
@@ -0,0 +1,111 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+#include "iotsitewise/odbc/authentication/refreshing_credentials_provider.h"
+
+#include <memory>
+
+#include <aws/core/utils/DateTime.h>
+
+#include "iotsitewise/odbc/log.h"
+#include "iotsitewise/odbc/thread_pool.h"
+
+namespace iotsitewise {
+namespace odbc {
+std::mutex RefreshingCredentialsProvider::renewalsMutex_;
+std::condition_variable RefreshingCredentialsProvider::renewalsCv_;
+size_t RefreshingCredentialsProvider::renewals_ = 0;
+
+RefreshingCredentialsProvider::RefreshingCredentialsProvider(
+    const Aws::Auth::AWSCredentials& credentials, const Fetcher& fetcher,
+    int32_t refreshWindow)
+    : fetcher_(fetcher),
+      refreshWindow_(refreshWindow),
+      credentials_(credentials),
+      isRefreshing_(false) {
+  // No-op.
+}
+
+Aws::Auth::AWSCredentials RefreshingCredentialsProvider::GetAWSCredentials() {
+  Aws::Auth::AWSCredentials credentials;
+  {
+    std::lock_guard< std::mutex > lock(mutex_);
+    credentials = credentials_;
+    if (isRefreshing_ || std::chrono::steady_clock::now() < nextAttempt_
+        || credentials.GetExpiration() - Aws::Utils::DateTime::Now()
+               > std::chrono::seconds(refreshWindow_)) {
+      return credentials;
+    }
+    isRefreshing_ = true;
+  }
+
+  LOG_DEBUG_MSG("Renewing the connection credentials in the background");
+  std::shared_ptr< ThreadPool > pool = ThreadPool::GetInstance();
+  {
+    std::lock_guard< std::mutex > lock(renewalsMutex_);
+    ++renewals_;
+  }
+  // the queued renewal does not keep the provider, the last reference
+  // may be released by a worker, so nothing here waits for the renewal
+  std::weak_ptr< RefreshingCredentialsProvider > weak = shared_from_this();
+  pool->Submit(this, [weak]() {
+    {
+      std::shared_ptr< RefreshingCredentialsProvider > self = weak.lock();
+      if (self) {
+        self->Refresh();
+      }
+    }
+    FinishRenewal();
+  });
+  return credentials;
+}
+
+void RefreshingCredentialsProvider::WaitForRefresh() {
+  std::unique_lock< std::mutex > lock(mutex_);
+  cv_.wait(lock, [this]() { return !isRefreshing_; });
+}
+
+void RefreshingCredentialsProvider::WaitForRenewals() {
+  std::unique_lock< std::mutex > lock(renewalsMutex_);
+  renewalsCv_.wait(lock, []() { return renewals_ == 0; });
+}
+
+void RefreshingCredentialsProvider::FinishRenewal() {
+  std::lock_guard< std::mutex > lock(renewalsMutex_);
+  --renewals_;
+  renewalsCv_.notify_all();
+}
+
+void RefreshingCredentialsProvider::Refresh() {
+  Aws::Auth::AWSCredentials credentials;
+  std::string errInfo;
+  bool isFetched =
+      fetcher_(credentials, errInfo) && !credentials.IsExpiredOrEmpty();
+
+  std::lock_guard< std::mutex > lock(mutex_);
+  if (isFetched) {
+    credentials_ = credentials;
+    LOG_DEBUG_MSG("Connection credentials are renewed");
+  } else {
+    // the current credentials are used until the next attempt
+    LOG_WARNING_MSG("Failed to renew the connection credentials. " << errInfo);
+    nextAttempt_ = std::chrono::steady_clock::now()
+                   + std::chrono::seconds(RETRY_INTERVAL_SECS);
+  }
+  isRefreshing_ = false;
+  cv_.notify_all();
+}
+}  // namespace odbc
+}  // namespace iotsitewise
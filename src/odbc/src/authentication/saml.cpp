@@ -38,6 +38,9 @@ bool IoTSiteWiseSAMLCredentialsProvider::FetchCredentialsWithSAMLAssertion(
     awsCredentials.SetAWSAccessKeyId(credentials.GetAccessKeyId());
     awsCredentials.SetAWSSecretKey(credentials.GetSecretAccessKey());
     awsCredentials.SetSessionToken(credentials.GetSessionToken());
+    if (credentials.ExpirationHasBeenSet()) {
+      awsCredentials.SetExpiration(credentials.GetExpiration());
+    }
 
     retval = true;
   } else {
@@ -0,0 +1,158 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+#include "iotsitewise/odbc/authentication/saml_credentials_cache.h"
+
+#include <chrono>
+
+#include <aws/core/utils/DateTime.h>
+
+#include "iotsitewise/odbc/authentication/auth_type.h"
+#include "iotsitewise/odbc/log.h"
+#include "iotsitewise/odbc/thread_pool.h"
+#include "iotsitewise/odbc/utility.h"
+
+namespace iotsitewise {
+namespace odbc {
+namespace {
+/**
+ * Append a field to a key. The field is prefixed with its length, so no
+ * value can be mistaken for a separator.
+ *
+ * @param key Key.
+ * @param value Field value.
+ */
+void AppendField(std::string& key, const std::string& value) {
+  key += std::to_string(value.size());
+  key += ':';
+  key += value;
+}
+}  // namespace
+
+SAMLCredentialsCache::SAMLCredentialsCache(int32_t refreshWindow)
+    : refreshWindow_(refreshWindow), refreshes_(0) {
+  // No-op.
+}
+
+SAMLCredentialsCache& SAMLCredentialsCache::GetInstance() {
+  // kept across connections, as applications often reconnect
+  static SAMLCredentialsCache instance;
+  return instance;
+}
+
+std::string SAMLCredentialsCache::MakeKey(const config::Configuration& config) {
+  std::string key;
+  AppendField(key, AuthType::ToString(config.GetAuthType()));
+  AppendField(key, config.GetIdPHost());
+  AppendField(key, config.GetAADTenant());
+  AppendField(key, config.GetOktaAppId());
+  AppendField(key, config.GetAADAppId());
+  AppendField(key, config.GetIdPUserName());
+  // the secrets are compared, so a wrong password gets no cached credentials
+  AppendField(key, config.GetIdPPassword());
+  AppendField(key, config.GetAADClientSecret());
+  AppendField(key, config.GetRoleArn());
+  AppendField(key, config.GetIdPArn());
+  // only the digest is kept, the secrets do not stay in the cache
+  return utility::Sha256Hex(key);
+}
+
+bool SAMLCredentialsCache::GetCredentials(
+    const std::string& key,
+    std::shared_ptr< IoTSiteWiseSAMLCredentialsProvider > provider,
+    Aws::Auth::AWSCredentials& credentials, std::string& errInfo) {
+  bool isDue = false;
+  {
+    std::lock_guard< std::mutex > lock(mutex_);
+    std::unordered_map< std::string, Entry >::iterator it = entries_.find(key);
+    if (it != entries_.end() && !it->second.credentials.IsExpiredOrEmpty()) {
+      LOG_DEBUG_MSG("Using the cached SAML credentials");
+      credentials = it->second.credentials;
+      isDue = !it->second.isRefreshing
+              && credentials.GetExpiration() - Aws::Utils::DateTime::Now()
+                     <= std::chrono::seconds(refreshWindow_);
+      if (!isDue) {
+        return true;
+      }
+      it->second.isRefreshing = true;
+      ++refreshes_;
+    }
+  }
+
+  if (isDue) {
+    LOG_DEBUG_MSG("Refreshing the cached SAML credentials in the background");
+    std::shared_ptr< ThreadPool > pool = ThreadPool::GetInstance();
+    // the provider is moved into the refresh, so it is released before the
+    // refresh is signaled and the task is destroyed
+    pool->Submit(this, [this, key, provider]() mutable {
+      Refresh(key, std::move(provider));
+    });
+    return true;
+  }
+
+  // nothing valid is cached, the caller waits for the IdP
+  if (!provider->GetAWSCredentials(credentials, errInfo)
+      || credentials.IsExpiredOrEmpty()) {
+    return false;
+  }
+
+  std::lock_guard< std::mutex > lock(mutex_);
+  entries_[key].credentials = credentials;
+  return true;
+}
+
+void SAMLCredentialsCache::WaitForRefreshes() {
+  std::unique_lock< std::mutex > lock(mutex_);
+  cv_.wait(lock, [this]() { return refreshes_ == 0; });
+}
+
+void SAMLCredentialsCache::Clear() {
+  std::lock_guard< std::mutex > lock(mutex_);
+  entries_.clear();
+}
+
+size_t SAMLCredentialsCache::GetSize() const {
+  std::lock_guard< std::mutex > lock(mutex_);
+  return entries_.size();
+}
+
+void SAMLCredentialsCache::Refresh(
+    const std::string& key,
+    std::shared_ptr< IoTSiteWiseSAMLCredentialsProvider > provider) {
+  Aws::Auth::AWSCredentials credentials;
+  std::string errInfo;
+  bool isFetched = provider->GetAWSCredentials(credentials, errInfo)
+                   && !credentials.IsExpiredOrEmpty();
+  // the provider owns the shared SDK clients, they must be released before
+  // WaitForRefreshes returns and the SDK is shut down
+  provider.reset();
+
+  std::lock_guard< std::mutex > lock(mutex_);
+  std::unordered_map< std::string, Entry >::iterator it = entries_.find(key);
+  if (it != entries_.end()) {
+    if (isFetched) {
+      it->second.credentials = credentials;
+    } else {
+      LOG_WARNING_MSG("Failed to refresh the cached SAML credentials, they "
+                      "are used until they expire. "
+                      << errInfo);
+    }
+    it->second.isRefreshing = false;
+  }
+  --refreshes_;
+  cv_.notify_all();
+}
+}  // namespace odbc
+}  // namespace iotsitewise
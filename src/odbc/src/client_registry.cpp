@@ -0,0 +1,162 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "iotsitewise/odbc/client_registry.h"
+
+#include <sstream>
+
+#include "iotsitewise/odbc/log.h"
+#include "iotsitewise/odbc/utility.h"
+
+namespace iotsitewise {
+namespace odbc {
+namespace {
+/**
+ * Append a field to a key. The field is prefixed with its length, so no
+ * value can be mistaken for a separator.
+ *
+ * @param key Key.
+ * @param value Field value.
+ */
+template < typename T >
+void AppendField(std::string& key, const T& value) {
+  std::stringstream field;
+  field << value;
+  std::string text = field.str();
+  key += std::to_string(text.size());
+  key += ':';
+  key += text;
+}
+}  // namespace
+
+ClientRegistry::ClientRegistry(int32_t idleTimeout)
+    : idleTimeout_(idleTimeout) {
+  // No-op.
+}
+
+ClientRegistry& ClientRegistry::GetInstance() {
+  // kept across connections, as applications often reconnect
+  static ClientRegistry instance;
+  return instance;
+}
+
+std::string ClientRegistry::MakeKey(
+    const Aws::Auth::AWSCredentials& credentials,
+    const Aws::Client::ClientConfiguration& clientCfg,
+    const std::string& endpoint, int32_t maxRetryCount,
+    bool rawResponseDecoding) {
+  std::string key;
+  AppendField(key, endpoint);
+  AppendField(key, clientCfg.region);
+  AppendField(key, credentials.GetAWSAccessKeyId());
+  AppendField(key, credentials.GetAWSSecretKey());
+  AppendField(key, credentials.GetSessionToken());
+  AppendField(key, clientCfg.connectTimeoutMs);
+  AppendField(key, clientCfg.requestTimeoutMs);
+  AppendField(key, clientCfg.maxConnections);
+  AppendField(key, clientCfg.userAgent);
+  AppendField(key, static_cast< int >(clientCfg.proxyScheme));
+  AppendField(key, clientCfg.proxyHost);
+  AppendField(key, clientCfg.proxyPort);
+  AppendField(key, clientCfg.proxyUserName);
+  AppendField(key, clientCfg.proxyPassword);
+  AppendField(key, clientCfg.proxySSLCertPath);
+  AppendField(key, clientCfg.proxySSLCertType);
+  AppendField(key, clientCfg.proxySSLKeyPath);
+  AppendField(key, clientCfg.proxySSLKeyType);
+  AppendField(key, clientCfg.proxySSLKeyPassword);
+  AppendField(key, maxRetryCount);
+  AppendField(key, rawResponseDecoding);
+  // the registry outlives the connections, it keeps no secret
+  return utility::Sha256Hex(key);
+}
+
+std::shared_ptr< QueryClient > ClientRegistry::Acquire(
+    const std::string& key, const Factory& factory) {
+  std::vector< std::shared_ptr< QueryClient > > expired;
+  std::shared_ptr< QueryClient > client;
+  {
+    std::lock_guard< std::mutex > lock(mutex_);
+    RemoveExpired(expired);
+
+    std::unordered_map< std::string, Entry >::iterator it =
+        entries_.find(key);
+    if (it == entries_.end()) {
+      client = factory();
+      if (!client) {
+        return client;
+      }
+      LOG_DEBUG_MSG("Registering a new IoT SiteWise client");
+      Entry entry;
+      entry.client = client;
+      entry.leases = 0;
+      it = entries_.emplace(key, entry).first;
+    } else {
+      LOG_DEBUG_MSG("Reusing the registered IoT SiteWise client");
+      client = it->second.client;
+    }
+    ++it->second.leases;
+  }
+
+  // all copies share one lease, it is released with the last of them
+  return std::shared_ptr< QueryClient >(
+      client.get(),
+      [this, key, client](QueryClient* ptr) { Release(key, ptr); });
+}
+
+void ClientRegistry::Clear() {
+  std::vector< std::shared_ptr< QueryClient > > removed;
+  std::lock_guard< std::mutex > lock(mutex_);
+  for (std::pair< const std::string, Entry >& entry : entries_) {
+    removed.push_back(std::move(entry.second.client));
+  }
+  entries_.clear();
+}
+
+size_t ClientRegistry::GetSize() const {
+  std::lock_guard< std::mutex > lock(mutex_);
+  return entries_.size();
+}
+
+void ClientRegistry::Release(const std::string& key,
+                             const QueryClient* client) {
+  std::vector< std::shared_ptr< QueryClient > > expired;
+  std::lock_guard< std::mutex > lock(mutex_);
+  std::unordered_map< std::string, Entry >::iterator it = entries_.find(key);
+  if (it != entries_.end() && it->second.client.get() == client
+      && --it->second.leases == 0) {
+    it->second.released = Clock::now();
+  }
+  RemoveExpired(expired);
+}
+
+void ClientRegistry::RemoveExpired(
+    std::vector< std::shared_ptr< QueryClient > >& expired) {
+  Clock::time_point now = Clock::now();
+  std::unordered_map< std::string, Entry >::iterator it = entries_.begin();
+  while (it != entries_.end()) {
+    if (it->second.leases == 0
+        && now >= it->second.released + std::chrono::seconds(idleTimeout_)) {
+      LOG_DEBUG_MSG("Removing an unused IoT SiteWise client");
+      expired.push_back(std::move(it->second.client));
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+}  // namespace odbc
+}  // namespace iotsitewise
@@ -83,6 +83,35 @@ const LogLevel::Type Configuration::DefaultValue::logLevel = DEFAULT_LOG_LEVEL;
 const std::string Configuration::DefaultValue::logPath = DEFAULT_LOG_PATH;
 const int32_t Configuration::DefaultValue::maxRowPerPage =
     DEFAULT_MAX_ROW_PER_PAGE;
+const int32_t Configuration::DefaultValue::prefetchPages =
+    DEFAULT_PREFETCH_PAGES;
+const int32_t Configuration::DefaultValue::metadataCacheSize =
+    DEFAULT_METADATA_CACHE_SIZE;
+const int32_t Configuration::DefaultValue::metadataCacheTTL =
+    DEFAULT_METADATA_CACHE_TTL;
+const int32_t Configuration::DefaultValue::firstPageSize =
+    DEFAULT_FIRST_PAGE_SIZE;
+const int32_t Configuration::DefaultValue::pageMemoryBudget =
+    DEFAULT_PAGE_MEMORY_BUDGET;
+const int32_t Configuration::DefaultValue::resultCacheTTL =
+    DEFAULT_RESULT_CACHE_TTL;
+const int32_t Configuration::DefaultValue::resultCacheSize =
+    DEFAULT_RESULT_CACHE_SIZE;
+const bool Configuration::DefaultValue::queryCoalescing =
+    DEFAULT_QUERY_COALESCING;
+const bool Configuration::DefaultValue::nestedValuesAsJson =
+    DEFAULT_NESTED_VALUES_AS_JSON;
+const bool Configuration::DefaultValue::logAsync = DEFAULT_LOG_ASYNC;
+const int32_t Configuration::DefaultValue::logQueueSize =
+    DEFAULT_LOG_QUEUE_SIZE;
+const bool Configuration::DefaultValue::logDropWhenFull =
+    DEFAULT_LOG_DROP_WHEN_FULL;
+const bool Configuration::DefaultValue::rawResponseDecoding =
+    DEFAULT_RAW_RESPONSE_DECODING;
+const ValidationMode::Type Configuration::DefaultValue::connectionValidation =
+    DEFAULT_CONNECTION_VALIDATION;
+const bool Configuration::DefaultValue::samlCredentialsCache =
+    DEFAULT_SAML_CREDENTIALS_CACHE;
 
 std::string Configuration::ToConnectString() const {
   LOG_DEBUG_MSG("ToConnectString is called");
@@ -482,6 +511,188 @@ bool Configuration::IsMaxRowPerPageSet() const {
   return maxRowPerPage.IsSet();
 }
 
+int32_t Configuration::GetPrefetchPages() const {
+  return prefetchPages.GetValue();
+}
+
+void Configuration::SetPrefetchPages(int32_t value) {
+  this->prefetchPages.SetValue(value);
+}
+
+bool Configuration::IsPrefetchPagesSet() const {
+  return prefetchPages.IsSet();
+}
+
+int32_t Configuration::GetMetadataCacheSize() const {
+  return metadataCacheSize.GetValue();
+}
+
+void Configuration::SetMetadataCacheSize(int32_t value) {
+  this->metadataCacheSize.SetValue(value);
+}
+
+bool Configuration::IsMetadataCacheSizeSet() const {
+  return metadataCacheSize.IsSet();
+}
+
+int32_t Configuration::GetMetadataCacheTTL() const {
+  return metadataCacheTTL.GetValue();
+}
+
+void Configuration::SetMetadataCacheTTL(int32_t value) {
+  this->metadataCacheTTL.SetValue(value);
+}
+
+bool Configuration::IsMetadataCacheTTLSet() const {
+  return metadataCacheTTL.IsSet();
+}
+
+int32_t Configuration::GetFirstPageSize() const {
+  return firstPageSize.GetValue();
+}
+
+void Configuration::SetFirstPageSize(int32_t value) {
+  this->firstPageSize.SetValue(value);
+}
+
+bool Configuration::IsFirstPageSizeSet() const {
+  return firstPageSize.IsSet();
+}
+
+int32_t Configuration::GetPageMemoryBudget() const {
+  return pageMemoryBudget.GetValue();
+}
+
+void Configuration::SetPageMemoryBudget(int32_t value) {
+  this->pageMemoryBudget.SetValue(value);
+}
+
+bool Configuration::IsPageMemoryBudgetSet() const {
+  return pageMemoryBudget.IsSet();
+}
+
+int32_t Configuration::GetResultCacheTTL() const {
+  return resultCacheTTL.GetValue();
+}
+
+void Configuration::SetResultCacheTTL(int32_t value) {
+  this->resultCacheTTL.SetValue(value);
+}
+
+bool Configuration::IsResultCacheTTLSet() const {
+  return resultCacheTTL.IsSet();
+}
+
+int32_t Configuration::GetResultCacheSize() const {
+  return resultCacheSize.GetValue();
+}
+
+void Configuration::SetResultCacheSize(int32_t value) {
+  this->resultCacheSize.SetValue(value);
+}
+
+bool Configuration::IsResultCacheSizeSet() const {
+  return resultCacheSize.IsSet();
+}
+
+bool Configuration::GetQueryCoalescing() const {
+  return queryCoalescing.GetValue();
+}
+
+void Configuration::SetQueryCoalescing(bool value) {
+  this->queryCoalescing.SetValue(value);
+}
+
+bool Configuration::IsQueryCoalescingSet() const {
+  return queryCoalescing.IsSet();
+}
+
+bool Configuration::GetNestedValuesAsJson() const {
+  return nestedValuesAsJson.GetValue();
+}
+
+void Configuration::SetNestedValuesAsJson(bool value) {
+  this->nestedValuesAsJson.SetValue(value);
+}
+
+bool Configuration::IsNestedValuesAsJsonSet() const {
+  return nestedValuesAsJson.IsSet();
+}
+
+bool Configuration::GetLogAsync() const {
+  return logAsync.GetValue();
+}
+
+void Configuration::SetLogAsync(bool value) {
+  this->logAsync.SetValue(value);
+}
+
+bool Configuration::IsLogAsyncSet() const {
+  return logAsync.IsSet();
+}
+
+int32_t Configuration::GetLogQueueSize() const {
+  return logQueueSize.GetValue();
+}
+
+void Configuration::SetLogQueueSize(int32_t value) {
+  this->logQueueSize.SetValue(value);
+}
+
+bool Configuration::IsLogQueueSizeSet() const {
+  return logQueueSize.IsSet();
+}
+
+bool Configuration::GetLogDropWhenFull() const {
+  return logDropWhenFull.GetValue();
+}
+
+void Configuration::SetLogDropWhenFull(bool value) {
+  this->logDropWhenFull.SetValue(value);
+}
+
+bool Configuration::IsLogDropWhenFullSet() const {
+  return logDropWhenFull.IsSet();
+}
+
+bool Configuration::GetRawResponseDecoding() const {
+  return rawResponseDecoding.GetValue();
+}
+
+void Configuration::SetRawResponseDecoding(bool value) {
+  this->rawResponseDecoding.SetValue(value);
+}
+
+bool Configuration::IsRawResponseDecodingSet() const {
+  return rawResponseDecoding.IsSet();
+}
+
+ValidationMode::Type Configuration::GetConnectionValidation() const {
+  return connectionValidation.GetValue();
+}
+
+void Configuration::SetConnectionValidation(const ValidationMode::Type value) {
+  if (value != ValidationMode::Type::UNKNOWN) {
+    this->connectionValidation.SetValue(value);
+  }
+}
+
+bool Configuration::IsConnectionValidationSet() const {
+  return connectionValidation.IsSet();
+}
+
+bool Configuration::GetSAMLCredentialsCache() const {
+  return samlCredentialsCache.GetValue();
+}
+
+void Configuration::SetSAMLCredentialsCache(bool value) {
+  this->samlCredentialsCache.SetValue(value);
+}
+
+bool Configuration::IsSAMLCredentialsCacheSet() const {
+  return samlCredentialsCache.IsSet();
+}
+
 void Configuration::ToMap(ArgumentMap& res) const {
   AddToMap(res, ConnectionStringParser::Key::dsn, dsn);
   AddToMap(res, ConnectionStringParser::Key::driver, driver);
@@ -512,6 +723,28 @@ void Configuration::ToMap(ArgumentMap& res) const {
   AddToMap(res, ConnectionStringParser::Key::logLevel, logLevel);
   AddToMap(res, ConnectionStringParser::Key::logPath, logPath);
   AddToMap(res, ConnectionStringParser::Key::maxRowPerPage, maxRowPerPage);
+  AddToMap(res, ConnectionStringParser::Key::prefetchPages, prefetchPages);
+  AddToMap(res, ConnectionStringParser::Key::metadataCacheSize,
+           metadataCacheSize);
+  AddToMap(res, ConnectionStringParser::Key::metadataCacheTTL,
+           metadataCacheTTL);
+  AddToMap(res, ConnectionStringParser::Key::firstPageSize, firstPageSize);
+  AddToMap(res, ConnectionStringParser::Key::pageMemoryBudget,
+           pageMemoryBudget);
+  AddToMap(res, ConnectionStringParser::Key::resultCacheTTL, resultCacheTTL);
+  AddToMap(res, ConnectionStringParser::Key::resultCacheSize, resultCacheSize);
+  AddToMap(res, ConnectionStringParser::Key::queryCoalescing, queryCoalescing);
+  AddToMap(res, ConnectionStringParser::Key::nestedValuesAsJson,
+           nestedValuesAsJson);
+  AddToMap(res, ConnectionStringParser::Key::logAsync, logAsync);
+  AddToMap(res, ConnectionStringParser::Key::logQueueSize, logQueueSize);
+  AddToMap(res, ConnectionStringParser::Key::logDropWhenFull, logDropWhenFull);
+  AddToMap(res, ConnectionStringParser::Key::rawResponseDecoding,
+           rawResponseDecoding);
+  AddToMap(res, ConnectionStringParser::Key::connectionValidation,
+           connectionValidation);
+  AddToMap(res, ConnectionStringParser::Key::samlCredentialsCache,
+           samlCredentialsCache);
 }
 
 void Configuration::Validate() const {
@@ -603,6 +836,15 @@ void Configuration::AddToMap(ArgumentMap& map, const std::string& key,
     map[key] = LogLevel::ToString(value.GetValue());
   }
 }
+
+template <>
+void Configuration::AddToMap(
+    ArgumentMap& map, const std::string& key,
+    const SettableValue< ValidationMode::Type >& value) {
+  if (value.IsSet()) {
+    map[key] = ValidationMode::ToString(value.GetValue());
+  }
+}
 }  // namespace config
 }  // namespace odbc
 }  // namespace iotsitewise
@@ -63,6 +63,32 @@ const std::string ConnectionStringParser::Key::aadTenant = "aadtenant";
 const std::string ConnectionStringParser::Key::logLevel = "loglevel";
 const std::string ConnectionStringParser::Key::logPath = "logoutput";
 const std::string ConnectionStringParser::Key::maxRowPerPage = "maxrowperpage";
+const std::string ConnectionStringParser::Key::prefetchPages = "prefetchpages";
+const std::string ConnectionStringParser::Key::metadataCacheSize =
+    "metadatacachesize";
+const std::string ConnectionStringParser::Key::metadataCacheTTL =
+    "metadatacachettl";
+const std::string ConnectionStringParser::Key::firstPageSize = "firstpagesize";
+const std::string ConnectionStringParser::Key::pageMemoryBudget =
+    "pagememorybudget";
+const std::string ConnectionStringParser::Key::resultCacheTTL =
+    "resultcachettl";
+const std::string ConnectionStringParser::Key::resultCacheSize =
+    "resultcachesize";
+const std::string ConnectionStringParser::Key::queryCoalescing =
+    "querycoalescing";
+const std::string ConnectionStringParser::Key::nestedValuesAsJson =
+    "nestedvaluesasjson";
+const std::string ConnectionStringParser::Key::logAsync = "logasync";
+const std::string ConnectionStringParser::Key::logQueueSize = "logqueuesize";
+const std::string ConnectionStringParser::Key::logDropWhenFull =
+    "logdropwhenfull";
+const std::string ConnectionStringParser::Key::rawResponseDecoding =
+    "rawresponsedecoding";
+const std::string ConnectionStringParser::Key::connectionValidation =
+    "connectionvalidation";
+const std::string ConnectionStringParser::Key::samlCredentialsCache =
+    "samlcredentialscache";
 
 ConnectionStringParser::ConnectionStringParser(Configuration& cfg) : cfg(cfg) {
   // No-op.
@@ -596,6 +622,533 @@ void ConnectionStringParser::HandleAttributePair(
     }
 
     cfg.SetMaxRowPerPage(static_cast< uint32_t >(numValue));
+  } else if (lKey == Key::prefetchPages) {
+    if (value.empty()) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Prefetch Pages attribute value is empty. Using "
+                             "default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (!iotsitewise::odbc::common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Prefetch Pages attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(INT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Prefetch Pages attribute value is too large. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue <= 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Prefetch Pages attribute value is out of range. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetPrefetchPages(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::metadataCacheSize) {
+    if (value.empty()) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata Cache Size attribute value is empty. Using "
+                             "default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (!iotsitewise::odbc::common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata Cache Size attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(INT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata Cache Size attribute value is too large. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue < 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata Cache Size attribute value is out of range. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetMetadataCacheSize(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::metadataCacheTTL) {
+    if (value.empty()) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata Cache TTL attribute value is empty. Using "
+                             "default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (!iotsitewise::odbc::common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata Cache TTL attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(INT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata Cache TTL attribute value is too large. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue < 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata Cache TTL attribute value is out of range. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetMetadataCacheTTL(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::firstPageSize) {
+    if (value.empty()) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("First page size attribute value is empty. Using "
+                             "default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (!iotsitewise::odbc::common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("First page size attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(INT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("First page size attribute value is too large. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue < 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("First page size attribute value is out of range. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetFirstPageSize(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::pageMemoryBudget) {
+    if (value.empty()) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Page memory budget attribute value is empty. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (!iotsitewise::odbc::common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Page memory budget attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(INT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Page memory budget attribute value is too large. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue <= 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Page memory budget attribute value is out of "
+                             "range. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetPageMemoryBudget(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::resultCacheTTL) {
+    if (value.empty()) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Result Cache TTL attribute value is empty. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (!iotsitewise::odbc::common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Result Cache TTL attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(INT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Result Cache TTL attribute value is too large. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue < 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Result Cache TTL attribute value is out of "
+                             "range. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetResultCacheTTL(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::resultCacheSize) {
+    if (value.empty()) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Result Cache Size attribute value is empty. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (!iotsitewise::odbc::common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Result Cache Size attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(INT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Result Cache Size attribute value is too large. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue <= 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Result Cache Size attribute value is out of "
+                             "range. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetResultCacheSize(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::queryCoalescing) {
+    BoolParseResult::Type res = StringToBool(value);
+
+    if (res == BoolParseResult::Type::AI_UNRECOGNIZED) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Query Coalescing attribute value is not a "
+                             "boolean. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetQueryCoalescing(res == BoolParseResult::Type::AI_TRUE);
+  } else if (lKey == Key::nestedValuesAsJson) {
+    BoolParseResult::Type res = StringToBool(value);
+
+    if (res == BoolParseResult::Type::AI_UNRECOGNIZED) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Nested Values As JSON attribute value is not a "
+                             "boolean. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetNestedValuesAsJson(res == BoolParseResult::Type::AI_TRUE);
+  } else if (lKey == Key::logAsync) {
+    BoolParseResult::Type res = StringToBool(value);
+
+    if (res == BoolParseResult::Type::AI_UNRECOGNIZED) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Log Async attribute value is not a boolean. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetLogAsync(res == BoolParseResult::Type::AI_TRUE);
+  } else if (lKey == Key::logQueueSize) {
+    if (value.empty()) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Log Queue Size attribute value is empty. Using "
+                             "default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (!iotsitewise::odbc::common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Log Queue Size attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(INT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Log Queue Size attribute value is too large. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue <= 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Log Queue Size attribute value is out of range. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetLogQueueSize(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::logDropWhenFull) {
+    BoolParseResult::Type res = StringToBool(value);
+
+    if (res == BoolParseResult::Type::AI_UNRECOGNIZED) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Log Drop When Full attribute value is not a "
+                             "boolean. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetLogDropWhenFull(res == BoolParseResult::Type::AI_TRUE);
+  } else if (lKey == Key::rawResponseDecoding) {
+    BoolParseResult::Type res = StringToBool(value);
+
+    if (res == BoolParseResult::Type::AI_UNRECOGNIZED) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Raw Response Decoding attribute value is not a "
+                             "boolean. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetRawResponseDecoding(res == BoolParseResult::Type::AI_TRUE);
+  } else if (lKey == Key::connectionValidation) {
+    ValidationMode::Type mode = ValidationMode::FromString(value);
+
+    if (mode == ValidationMode::Type::UNKNOWN) {
+      if (diag) {
+        diag->AddStatusRecord(SqlState::S01S02_OPTION_VALUE_CHANGED,
+                              "Specified Connection Validation is not "
+                              "supported. Default value used ('full').");
+      }
+      return;
+    }
+
+    cfg.SetConnectionValidation(mode);
+  } else if (lKey == Key::samlCredentialsCache) {
+    BoolParseResult::Type res = StringToBool(value);
+
+    if (res == BoolParseResult::Type::AI_UNRECOGNIZED) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("SAML Credentials Cache attribute value is not a "
+                             "boolean. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetSAMLCredentialsCache(res == BoolParseResult::Type::AI_TRUE);
   } else if (diag) {
     std::stringstream stream;
 
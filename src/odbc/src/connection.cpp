@@ -28,6 +28,7 @@
 #include <sstream>
 
 #include "iotsitewise/odbc/utils.h"
+#include "iotsitewise/odbc/client_registry.h"
 #include "iotsitewise/odbc/config/configuration.h"
 #include "iotsitewise/odbc/config/connection_string_parser.h"
 #include "iotsitewise/odbc/dsn_config.h"
@@ -39,6 +40,7 @@
 
 #include "iotsitewise/odbc/authentication/aad.h"
 #include "iotsitewise/odbc/authentication/okta.h"
+#include "iotsitewise/odbc/authentication/saml_credentials_cache.h"
 
 #include <aws/iotsitewise/model/ExecuteQueryRequest.h>
 #include <aws/iotsitewise/model/ExecuteQueryResult.h>
@@ -56,9 +58,18 @@ namespace odbc {
 std::mutex Connection::mutex_;
 bool Connection::awsSDKReady_ = false;
 std::atomic< int > Connection::refCount_(0);
+std::mutex Connection::validatedMutex_;
+std::set< std::string > Connection::validated_;
+std::shared_ptr< Aws::Http::HttpClient > Connection::sharedHttpClient_;
+std::shared_ptr< Aws::STS::STSClient > Connection::sharedStsClient_;
 
 Connection::Connection(Environment* env)
-    : env_(env), info_(config_), metadataID_(false) {
+    : env_(env),
+      info_(config_),
+      metadataID_(false),
+      metaCache_(DEFAULT_METADATA_CACHE_SIZE, DEFAULT_METADATA_CACHE_TTL),
+      resultCacheHits_(0),
+      resultCacheMisses_(0) {
   LOG_DEBUG_MSG("Connection is called");
   // The AWS SDK for C++ must be initialized by calling Aws::InitAPI.
   // It should only be initialized only once during the application running
@@ -94,6 +105,19 @@ Connection::~Connection() {
   // destructor during the application running. The atomic counter
   // guarantees this.
   if (0 == --refCount_) {
+    // the unused shared clients must not outlive the SDK
+    SAMLCredentialsCache::GetInstance().WaitForRefreshes();
+    RefreshingCredentialsProvider::WaitForRenewals();
+    {
+      std::lock_guard< std::mutex > lock(mutex_);
+      sharedHttpClient_.reset();
+      sharedStsClient_.reset();
+    }
+    ClientRegistry::GetInstance().Clear();
+    {
+      std::lock_guard< std::mutex > lock(validatedMutex_);
+      validated_.clear();
+    }
     Aws::ShutdownAPI(options_);
     awsSDKReady_ = false;
     LOG_DEBUG_MSG("AWS SDK is shut down");
@@ -200,6 +224,16 @@ SqlResult::Type Connection::InternalEstablish(
     return SqlResult::AI_ERROR;
   }
 
+  metaCache_.Configure(static_cast< size_t >(config_.GetMetadataCacheSize()),
+                       config_.GetMetadataCacheTTL());
+
+  if (config_.GetLogAsync()) {
+    iotsitewise::odbc::Logger::GetLoggerInstance()->StartAsync(
+        static_cast< size_t >(config_.GetLogQueueSize()),
+        config_.GetLogDropWhenFull());
+    isLogAsync_ = true;
+  }
+
   bool errors = GetDiagnosticRecords().GetStatusRecordsNumber() > 0;
 
   LOG_DEBUG_MSG("errors is " << errors);
@@ -215,8 +249,7 @@ void Connection::Deregister() {
   env_->DeregisterConnection(this);
 }
 
-std::shared_ptr< Aws::IoTSiteWise::IoTSiteWiseClient >
-Connection::GetClient() const {
+std::shared_ptr< QueryClient > Connection::GetClient() const {
   return client_;
 }
 
@@ -244,9 +277,69 @@ void Connection::Close() {
     client_.reset();
   }
 
+  credentialsFetcher_ = nullptr;
+
   if (samlCredProvider_) {
     samlCredProvider_.reset();
   }
+
+  LOG_INFO_MSG("Result set metadata cache hits: "
+               << metaCache_.GetHits()
+               << ", misses: " << metaCache_.GetMisses());
+  metaCache_.Clear();
+  if (config_.GetResultCacheTTL() > 0) {
+    LOG_INFO_MSG("Query result cache hits: "
+                 << resultCacheHits_.load()
+                 << ", misses: " << resultCacheMisses_.load());
+  }
+
+  if (isLogAsync_) {
+    iotsitewise::odbc::Logger::GetLoggerInstance()->StopAsync();
+    isLogAsync_ = false;
+  }
+}
+
+std::string Connection::GetCredentialsIdentity() const {
+  // only the settings naming the principal, never the secrets
+  std::string identity =
+      AuthType::ToString(config_.GetAuthType()) + ';' + config_.GetRegion()
+      + ';' + config_.GetEndpoint() + ';';
+  switch (config_.GetAuthType()) {
+    case AuthType::Type::IAM:
+      identity += config_.GetDSNUserName();
+      break;
+    case AuthType::Type::AWS_PROFILE:
+      identity += config_.GetProfileName();
+      break;
+    case AuthType::Type::OKTA:
+      identity += config_.GetIdPHost() + ';' + config_.GetIdPUserName() + ';'
+                  + config_.GetOktaAppId() + ';' + config_.GetRoleArn();
+      break;
+    case AuthType::Type::AAD:
+      identity += config_.GetAADTenant() + ';' + config_.GetIdPUserName()
+                  + ';' + config_.GetAADAppId() + ';' + config_.GetRoleArn();
+      break;
+  }
+  return identity;
+}
+
+std::string Connection::GetCredentialsDigest() const {
+  std::string secrets;
+  switch (config_.GetAuthType()) {
+    case AuthType::Type::IAM:
+      secrets = config_.GetDSNPassword() + ';' + config_.GetSessionToken();
+      break;
+    case AuthType::Type::OKTA:
+      secrets = config_.GetDSNPassword();
+      break;
+    case AuthType::Type::AAD:
+      secrets = config_.GetDSNPassword() + ';' + config_.GetAADClientSecret();
+      break;
+    default:
+      // the profile credentials are read from the files of the user
+      return std::string();
+  }
+  return utility::Sha256Hex(secrets);
 }
 
 Statement* Connection::CreateStatement() {
@@ -401,6 +494,54 @@ SqlResult::Type Connection::InternalGetAttribute(int attr, void* buf,
       break;
     }
 
+    case SQL_ATTR_SWMETADATA_CACHE_HITS: {
+      SQLULEN* val = reinterpret_cast< SQLULEN* >(buf);
+
+      *val = static_cast< SQLULEN >(metaCache_.GetHits());
+
+      if (valueLen) {
+        *valueLen = SQL_IS_UINTEGER;
+      }
+
+      break;
+    }
+
+    case SQL_ATTR_SWMETADATA_CACHE_MISSES: {
+      SQLULEN* val = reinterpret_cast< SQLULEN* >(buf);
+
+      *val = static_cast< SQLULEN >(metaCache_.GetMisses());
+
+      if (valueLen) {
+        *valueLen = SQL_IS_UINTEGER;
+      }
+
+      break;
+    }
+
+    case SQL_ATTR_SWRESULT_CACHE_HITS: {
+      SQLULEN* val = reinterpret_cast< SQLULEN* >(buf);
+
+      *val = static_cast< SQLULEN >(resultCacheHits_.load());
+
+      if (valueLen) {
+        *valueLen = SQL_IS_UINTEGER;
+      }
+
+      break;
+    }
+
+    case SQL_ATTR_SWRESULT_CACHE_MISSES: {
+      SQLULEN* val = reinterpret_cast< SQLULEN* >(buf);
+
+      *val = static_cast< SQLULEN >(resultCacheMisses_.load());
+
+      if (valueLen) {
+        *valueLen = SQL_IS_UINTEGER;
+      }
+
+      break;
+    }
+
     default: {
       AddStatusRecord(SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
                       "Specified attribute is not supported.",
@@ -423,7 +564,11 @@ SqlResult::Type Connection::InternalSetAttribute(int attr, void* value,
                                                  SQLINTEGER) {
   LOG_DEBUG_MSG("InternalSetAttribute is called, attr is " << attr);
   switch (attr) {
-    case SQL_ATTR_CONNECTION_DEAD: {
+    case SQL_ATTR_CONNECTION_DEAD:
+    case SQL_ATTR_SWMETADATA_CACHE_HITS:
+    case SQL_ATTR_SWMETADATA_CACHE_MISSES:
+    case SQL_ATTR_SWRESULT_CACHE_HITS:
+    case SQL_ATTR_SWRESULT_CACHE_MISSES: {
       AddStatusRecord(SqlState::SHY092_OPTION_TYPE_OUT_OF_RANGE,
                       "Attribute is read only.");
 
@@ -509,7 +654,12 @@ void UpdateConnectionRuntimeInfo(const config::Configuration& config,
 }
 
 std::shared_ptr< Aws::Http::HttpClient > Connection::GetHttpClient() {
-  return Aws::Http::CreateHttpClient(Aws::Client::ClientConfiguration());
+  std::lock_guard< std::mutex > lock(mutex_);
+  if (!sharedHttpClient_) {
+    sharedHttpClient_ =
+        Aws::Http::CreateHttpClient(Aws::Client::ClientConfiguration());
+  }
+  return sharedHttpClient_;
 }
 
 Aws::Utils::Logging::LogLevel Connection::GetAWSLogLevelFromString(
@@ -636,7 +786,34 @@ void Connection::SetClientProxy(Aws::Client::ClientConfiguration& clientCfg) {
 }
 
 std::shared_ptr< Aws::STS::STSClient > Connection::GetStsClient() {
-  return std::make_shared< Aws::STS::STSClient >();
+  std::lock_guard< std::mutex > lock(mutex_);
+  if (!sharedStsClient_) {
+    sharedStsClient_ = std::make_shared< Aws::STS::STSClient >();
+  }
+  return sharedStsClient_;
+}
+
+RefreshingCredentialsProvider::Fetcher
+Connection::MakeSAMLCredentialsFetcher() {
+  // the renewal asks the IdP directly, as the cached credentials are as
+  // close to their expiration as the ones being renewed
+  std::shared_ptr< IoTSiteWiseSAMLCredentialsProvider > provider =
+      samlCredProvider_;
+  return [provider](Aws::Auth::AWSCredentials& renewed,
+                    std::string& errInfo) {
+    return provider->GetAWSCredentials(renewed, errInfo);
+  };
+}
+
+bool Connection::GetSAMLCredentials(const config::Configuration& cfg,
+                                    Aws::Auth::AWSCredentials& credentials,
+                                    std::string& errInfo) {
+  if (!cfg.GetSAMLCredentialsCache()) {
+    return samlCredProvider_->GetAWSCredentials(credentials, errInfo);
+  }
+  return SAMLCredentialsCache::GetInstance().GetCredentials(
+      SAMLCredentialsCache::MakeKey(cfg), samlCredProvider_, credentials,
+      errInfo);
 }
 
 bool Connection::TryRestoreConnection(const config::Configuration& cfg,
@@ -653,19 +830,34 @@ bool Connection::TryRestoreConnection(const config::Configuration& cfg,
     samlCredProvider_ =
         std::make_shared< iotsitewise::odbc::IoTSiteWiseOktaCredentialsProvider >(
             cfg, httpClient, stsClient);
-    samlCredProvider_->GetAWSCredentials(credentials, errInfo);
+    GetSAMLCredentials(cfg, credentials, errInfo);
+    credentialsFetcher_ = MakeSAMLCredentialsFetcher();
   } else if (authType == AuthType::Type::AAD) {
     std::shared_ptr< Aws::Http::HttpClient > httpClient = GetHttpClient();
     std::shared_ptr< Aws::STS::STSClient > stsClient = GetStsClient();
     samlCredProvider_ =
         std::make_shared< iotsitewise::odbc::IoTSiteWiseAADCredentialsProvider >(
             cfg, httpClient, stsClient);
-    samlCredProvider_->GetAWSCredentials(credentials, errInfo);
+    GetSAMLCredentials(cfg, credentials, errInfo);
+    credentialsFetcher_ = MakeSAMLCredentialsFetcher();
   } else if (authType == AuthType::Type::AWS_PROFILE) {
-    Aws::Auth::ProfileConfigFileAWSCredentialsProvider credProvider(
-        cfg.GetProfileName().data());
-    credentials = credProvider.GetAWSCredentials();
+    std::shared_ptr< Aws::Auth::ProfileConfigFileAWSCredentialsProvider >
+        credProvider = std::make_shared<
+            Aws::Auth::ProfileConfigFileAWSCredentialsProvider >(
+            cfg.GetProfileName().data());
+    credentials = credProvider->GetAWSCredentials();
     LOG_DEBUG_MSG("profile name is " << cfg.GetProfileName());
+    // the profile is read again, as its credentials may be updated by tools
+    // such as credential_process or SSO
+    credentialsFetcher_ = [credProvider](Aws::Auth::AWSCredentials& renewed,
+                                         std::string& errInfo) {
+      renewed = credProvider->GetAWSCredentials();
+      if (renewed.IsEmpty()) {
+        errInfo = "No credentials in the profile";
+        return false;
+      }
+      return true;
+    };
   } else if (authType == AuthType::Type::IAM) {
     credentials.SetAWSAccessKeyId(cfg.GetDSNUserName());
     credentials.SetAWSSecretKey(cfg.GetDSNPassword());
@@ -728,45 +920,104 @@ bool Connection::TryRestoreConnection(const config::Configuration& cfg,
 
   client_ = CreateIoTSiteWiseClient(credentials, clientCfg);
 
-  const std::string& endpoint = cfg.GetEndpoint();
-  // endpoint could not be set to empty string
-  if (!endpoint.empty()) {
-    client_->OverrideEndpoint(endpoint);
-    LOG_DEBUG_MSG("endpoint is set to " << endpoint);
+  if (!ValidateConnection(credentials, clientCfg, err)) {
+    Close();
+    return false;
+  }
+
+  UpdateConnectionRuntimeInfo(config_, info_);
+
+  return true;
+}
+
+bool Connection::ValidateConnection(
+    const Aws::Auth::AWSCredentials& credentials,
+    const Aws::Client::ClientConfiguration& clientCfg, IgniteError& err) {
+  ValidationMode::Type mode = config_.GetConnectionValidation();
+  LOG_DEBUG_MSG("connection validation is " << ValidationMode::ToString(mode));
+  if (mode == ValidationMode::Type::LAZY) {
+    // invalid credentials are reported by the first statement
+    return true;
+  }
+
+  std::string key;
+  if (mode == ValidationMode::Type::ONCE) {
+    // the registry key is a digest, the secrets are not kept in memory
+    key = ClientRegistry::MakeKey(credentials, clientCfg,
+                                  config_.GetEndpoint(),
+                                  config_.GetMaxRetryCountClient(),
+                                  config_.GetRawResponseDecoding());
+    std::lock_guard< std::mutex > lock(validatedMutex_);
+    if (validated_.find(key) != validated_.end()) {
+      LOG_DEBUG_MSG("Credentials are already validated");
+      return true;
+    }
   }
-  
+
   // try a simple query with client
   Aws::IoTSiteWise::Model::ExecuteQueryRequest queryRequest;
   queryRequest.SetQueryStatement("SELECT table_name FROM system.tables");
- 
+  if (mode != ValidationMode::Type::FULL) {
+    // one row is enough to validate the credentials
+    queryRequest.SetMaxResults(1);
+  }
+
   Aws::IoTSiteWise::Model::ExecuteQueryOutcome outcome =
       client_->ExecuteQuery(queryRequest);
   if (!outcome.IsSuccess()) {
     auto error = outcome.GetError();
     LOG_DEBUG_MSG("ERROR: " << error.GetExceptionName() << ": "
                             << error.GetMessage());
- 
+
     err = IgniteError(IgniteError::IGNITE_ERR_SW_CONNECT,
                       std::string(error.GetExceptionName())
                           .append(": ")
                           .append(error.GetMessage())
                           .c_str());
- 
-    Close();
     return false;
   }
- 
-  UpdateConnectionRuntimeInfo(config_, info_);
- 
+
+  if (mode == ValidationMode::Type::ONCE) {
+    std::lock_guard< std::mutex > lock(validatedMutex_);
+    if (validated_.size() >= MAX_VALIDATED_CLIENTS) {
+      // forget the old clients, they are validated again on next use
+      LOG_DEBUG_MSG("Validated clients limit is reached, clearing");
+      validated_.clear();
+    }
+    validated_.insert(key);
+  }
   return true;
 }
 
-std::shared_ptr< Aws::IoTSiteWise::IoTSiteWiseClient >
-Connection::CreateIoTSiteWiseClient(
+std::shared_ptr< QueryClient > Connection::CreateIoTSiteWiseClient(
     const Aws::Auth::AWSCredentials& credentials,
     const Aws::Client::ClientConfiguration& clientCfg) {
-  return std::make_shared< Aws::IoTSiteWise::IoTSiteWiseClient >(
-      credentials, clientCfg);
+  const std::string& endpoint = config_.GetEndpoint();
+  bool rawResponseDecoding = config_.GetRawResponseDecoding();
+  // connections with the same settings share a client and its HTTP
+  // connections
+  std::string key =
+      ClientRegistry::MakeKey(credentials, clientCfg, endpoint,
+                              config_.GetMaxRetryCountClient(),
+                              rawResponseDecoding);
+  return ClientRegistry::GetInstance().Acquire(key, [&]() {
+    std::shared_ptr< QueryClient > client;
+    if (credentialsFetcher_) {
+      client = std::make_shared< QueryClient >(
+          std::make_shared< RefreshingCredentialsProvider >(
+              credentials, credentialsFetcher_),
+          clientCfg, rawResponseDecoding);
+    } else {
+      client = std::make_shared< QueryClient >(credentials, clientCfg,
+                                               rawResponseDecoding);
+    }
+    // endpoint could not be set to empty string
+    if (!endpoint.empty()) {
+      client->OverrideEndpoint(endpoint);
+      LOG_DEBUG_MSG("endpoint is set to " << endpoint);
+    }
+    return client;
+  });
 }
 
 Descriptor* Connection::CreateDescriptor() {
@@ -1424,11 +1675,17 @@ SqlResult::Type Connection::InternalSetStmtAttribute(SQLUSMALLINT option,
       stmtAttr_.rowsetSize = value;
       break;
     }
+    case SQL_QUERY_TIMEOUT: {
+      stmtAttr_.queryTimeout = value;
+      break;
+    }
+    case SQL_MAX_ROWS: {
+      stmtAttr_.maxRows = value;
+      break;
+    }
 
     // ignored attributes
     case SQL_NOSCAN:
-    case SQL_QUERY_TIMEOUT:
-    case SQL_MAX_ROWS:
     case SQL_MAX_LENGTH:
     case SQL_KEYSET_SIZE:
     case SQL_ASYNC_ENABLE: {
@@ -1509,7 +1766,6 @@ SqlResult::Type Connection::InternalGetConnectOption(SQLUSMALLINT option,
 #endif
     case SQL_TRANSLATE_DLL:
     case SQL_TRANSLATE_OPTION:
-    case SQL_QUERY_TIMEOUT:
     case SQL_ACCESS_MODE:
     case SQL_TXN_ISOLATION:
     case SQL_CURRENT_QUALIFIER:
@@ -1523,6 +1779,16 @@ SqlResult::Type Connection::InternalGetConnectOption(SQLUSMALLINT option,
       return SqlResult::AI_SUCCESS_WITH_INFO;
     }
 
+    case SQL_QUERY_TIMEOUT: {
+      *reinterpret_cast< SQLULEN* >(value) = stmtAttr_.queryTimeout;
+      return SqlResult::AI_SUCCESS;
+    }
+
+    case SQL_MAX_ROWS: {
+      *reinterpret_cast< SQLULEN* >(value) = stmtAttr_.maxRows;
+      return SqlResult::AI_SUCCESS;
+    }
+
     case SQL_AUTOCOMMIT:
     default:
       return InternalGetAttribute(option, value, 0, nullptr);
@@ -0,0 +1,402 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "iotsitewise/odbc/conversion_plan.h"
+
+#include <cstring>
+#include <ctime>
+
+#include <sqltypes.h>
+
+#include "iotsitewise/odbc/system/odbc_constants.h"
+#include "iotsitewise/odbc/utils.h"
+
+using Aws::IoTSiteWise::Model::ScalarType;
+using iotsitewise::odbc::app::ApplicationDataBuffer;
+using iotsitewise::odbc::app::ConversionResult;
+using iotsitewise::odbc::type_traits::OdbcNativeType;
+
+namespace iotsitewise {
+namespace odbc {
+namespace {
+typedef DecodedPage::Column Column;
+
+/** Decoded values of a column by value type. */
+template < typename T >
+struct ColumnValues;
+
+template <>
+struct ColumnValues< double > {
+  static const std::vector< double >& Get(const Column& column) {
+    return column.doubles;
+  }
+};
+
+template <>
+struct ColumnValues< int32_t > {
+  static const std::vector< int32_t >& Get(const Column& column) {
+    return column.ints;
+  }
+};
+
+template <>
+struct ColumnValues< Timestamp > {
+  static const std::vector< Timestamp >& Get(const Column& column) {
+    return column.timestamps;
+  }
+};
+
+/**
+ * Copy a number to a numeric buffer, see
+ * ApplicationDataBuffer::PutNumToNumBuffer.
+ */
+template < typename Tin, typename Tbuf >
+ConversionResult::Type PutNumToNum(const Column& column, size_t rowIdx,
+                                   ApplicationDataBuffer& dataBuf) {
+  if (column.nulls[rowIdx]) {
+    dataBuf.PutNull();
+    return ConversionResult::Type::AI_SUCCESS;
+  }
+
+  void* dataPtr = dataBuf.GetData();
+  if (dataPtr) {
+    *reinterpret_cast< Tbuf* >(dataPtr) =
+        static_cast< Tbuf >(ColumnValues< Tin >::Get(column)[rowIdx]);
+  }
+
+  SqlLen* resLenPtr = dataBuf.GetResLen();
+  if (resLenPtr) {
+    *resLenPtr = static_cast< SqlLen >(sizeof(Tbuf));
+  }
+  return ConversionResult::Type::AI_SUCCESS;
+}
+
+/**
+ * Array bound by the application. The elements are consecutive for
+ * column-wise binding and the fields of consecutive rows for row-wise
+ * binding.
+ */
+template < typename T >
+class BoundArray {
+ public:
+  BoundArray(void* base, SqlLen stride)
+      : base_(reinterpret_cast< char* >(base)),
+        stride_(static_cast< size_t >(stride)) {
+  }
+
+  /** Check if the array is bound. */
+  bool IsBound() const {
+    return base_ != nullptr;
+  }
+
+  /** Get an element. */
+  T& operator[](size_t idx) const {
+    return *reinterpret_cast< T* >(base_ + idx * stride_);
+  }
+
+ private:
+  char* base_;
+  size_t stride_;
+};
+
+/**
+ * Get the data array of a buffer starting at its current element.
+ */
+template < typename T >
+BoundArray< T > DataArray(ApplicationDataBuffer& dataBuf) {
+  return BoundArray< T >(dataBuf.GetData(), dataBuf.GetDataStride());
+}
+
+/**
+ * Get the result length array of a buffer starting at its current element.
+ */
+inline BoundArray< SqlLen > ResLenArray(ApplicationDataBuffer& dataBuf) {
+  return BoundArray< SqlLen >(dataBuf.GetResLen(), dataBuf.GetResLenStride());
+}
+
+/**
+ * Put a null to an element of a length/indicator array, see
+ * ApplicationDataBuffer::PutNull.
+ */
+inline ConversionResult::Type PutNullAt(const BoundArray< SqlLen >& resLen,
+                                        size_t idx) {
+  if (!resLen.IsBound()) {
+    return ConversionResult::Type::AI_INDICATOR_NEEDED;
+  }
+  resLen[idx] = SQL_NULL_DATA;
+  return ConversionResult::Type::AI_SUCCESS;
+}
+
+/**
+ * Copy a range of numbers to the elements of a numeric buffer array, see
+ * PutNumToNum.
+ */
+template < typename Tin, typename Tbuf >
+void PutNumToNumBulk(const Column& column, size_t firstRow, size_t rowCount,
+                     ApplicationDataBuffer& dataBuf,
+                     ConversionResult::Type* results) {
+  BoundArray< Tbuf > data = DataArray< Tbuf >(dataBuf);
+  BoundArray< SqlLen > resLen = ResLenArray(dataBuf);
+  const Tin* values = ColumnValues< Tin >::Get(column).data() + firstRow;
+  for (size_t i = 0; i < rowCount; i++) {
+    if (column.nulls[firstRow + i]) {
+      results[i] = PutNullAt(resLen, i);
+      continue;
+    }
+
+    if (data.IsBound()) {
+      data[i] = static_cast< Tbuf >(values[i]);
+    }
+    if (resLen.IsBound()) {
+      resLen[i] = static_cast< SqlLen >(sizeof(Tbuf));
+    }
+    results[i] = ConversionResult::Type::AI_SUCCESS;
+  }
+}
+
+/**
+ * Copy a timestamp to a SQL_TIMESTAMP_STRUCT.
+ */
+inline void CopyTimestamp(const Timestamp& value,
+                          SQL_TIMESTAMP_STRUCT* buffer) {
+  tm tmTime;
+  memset(&tmTime, 0, sizeof(tm));
+  iotsitewise::odbc::common::TimestampToCTm(value, tmTime);
+
+  buffer->year = tmTime.tm_year + 1900;
+  buffer->month = tmTime.tm_mon + 1;
+  buffer->day = tmTime.tm_mday;
+  buffer->hour = tmTime.tm_hour;
+  buffer->minute = tmTime.tm_min;
+  buffer->second = tmTime.tm_sec;
+  buffer->fraction = value.GetSecondFraction();
+}
+
+/**
+ * Copy a timestamp to a SQL_TIMESTAMP_STRUCT buffer, see
+ * ApplicationDataBuffer::PutTimestamp.
+ */
+ConversionResult::Type PutTimestampToTimestamp(
+    const Column& column, size_t rowIdx, ApplicationDataBuffer& dataBuf) {
+  if (column.nulls[rowIdx]) {
+    dataBuf.PutNull();
+    return ConversionResult::Type::AI_SUCCESS;
+  }
+
+  CopyTimestamp(column.timestamps[rowIdx],
+                reinterpret_cast< SQL_TIMESTAMP_STRUCT* >(dataBuf.GetData()));
+
+  SqlLen* resLenPtr = dataBuf.GetResLen();
+  if (resLenPtr) {
+    *resLenPtr = static_cast< SqlLen >(sizeof(SQL_TIMESTAMP_STRUCT));
+  }
+  return ConversionResult::Type::AI_SUCCESS;
+}
+
+/**
+ * Copy a range of timestamps to the elements of a SQL_TIMESTAMP_STRUCT
+ * buffer array, see PutTimestampToTimestamp.
+ */
+void PutTimestampToTimestampBulk(const Column& column, size_t firstRow,
+                                 size_t rowCount,
+                                 ApplicationDataBuffer& dataBuf,
+                                 ConversionResult::Type* results) {
+  BoundArray< SQL_TIMESTAMP_STRUCT > data =
+      DataArray< SQL_TIMESTAMP_STRUCT >(dataBuf);
+  BoundArray< SqlLen > resLen = ResLenArray(dataBuf);
+  for (size_t i = 0; i < rowCount; i++) {
+    if (column.nulls[firstRow + i]) {
+      results[i] = PutNullAt(resLen, i);
+      continue;
+    }
+
+    CopyTimestamp(column.timestamps[firstRow + i], &data[i]);
+    if (resLen.IsBound()) {
+      resLen[i] = static_cast< SqlLen >(sizeof(SQL_TIMESTAMP_STRUCT));
+    }
+    results[i] = ConversionResult::Type::AI_SUCCESS;
+  }
+}
+
+/**
+ * Put a double through ApplicationDataBuffer for the targets without a
+ * specialized converter, such as strings.
+ */
+ConversionResult::Type PutDouble(const Column& column, size_t rowIdx,
+                                 ApplicationDataBuffer& dataBuf) {
+  if (column.nulls[rowIdx]) {
+    dataBuf.PutNull();
+    return ConversionResult::Type::AI_SUCCESS;
+  }
+  return dataBuf.PutDouble(column.doubles[rowIdx]);
+}
+
+/**
+ * Put an int through ApplicationDataBuffer for the targets without a
+ * specialized converter.
+ */
+ConversionResult::Type PutInt32(const Column& column, size_t rowIdx,
+                                ApplicationDataBuffer& dataBuf) {
+  if (column.nulls[rowIdx]) {
+    dataBuf.PutNull();
+    return ConversionResult::Type::AI_SUCCESS;
+  }
+  return dataBuf.PutInt32(column.ints[rowIdx]);
+}
+
+/**
+ * Put a boolean through ApplicationDataBuffer for the targets without a
+ * specialized converter.
+ */
+ConversionResult::Type PutBoolean(const Column& column, size_t rowIdx,
+                                  ApplicationDataBuffer& dataBuf) {
+  if (column.nulls[rowIdx]) {
+    dataBuf.PutNull();
+    return ConversionResult::Type::AI_SUCCESS;
+  }
+  return dataBuf.PutInt8(static_cast< int8_t >(column.ints[rowIdx]));
+}
+
+/**
+ * Put a timestamp through ApplicationDataBuffer for the targets without a
+ * specialized converter.
+ */
+ConversionResult::Type PutTimestamp(const Column& column, size_t rowIdx,
+                                    ApplicationDataBuffer& dataBuf) {
+  if (column.nulls[rowIdx]) {
+    dataBuf.PutNull();
+    return ConversionResult::Type::AI_SUCCESS;
+  }
+  return dataBuf.PutTimestamp(column.timestamps[rowIdx]);
+}
+
+/**
+ * Converter of a column type that is not decoded.
+ */
+ConversionResult::Type Unsupported(const Column&, size_t,
+                                   ApplicationDataBuffer&) {
+  return ConversionResult::Type::AI_UNSUPPORTED_CONVERSION;
+}
+
+/**
+ * Get the converter of a number to a numeric buffer.
+ *
+ * @param target C type of the buffer.
+ * @param fallback Converter for the other targets.
+ * @return Converter.
+ */
+template < typename Tin >
+ConversionPlan::Converter ResolveNum(OdbcNativeType::Type target,
+                                     ConversionPlan::Converter fallback) {
+  switch (target) {
+    case OdbcNativeType::Type::AI_SIGNED_TINYINT:
+      return &PutNumToNum< Tin, signed char >;
+    case OdbcNativeType::Type::AI_BIT:
+    case OdbcNativeType::Type::AI_UNSIGNED_TINYINT:
+      return &PutNumToNum< Tin, unsigned char >;
+    case OdbcNativeType::Type::AI_SIGNED_SHORT:
+      return &PutNumToNum< Tin, SQLSMALLINT >;
+    case OdbcNativeType::Type::AI_UNSIGNED_SHORT:
+      return &PutNumToNum< Tin, SQLUSMALLINT >;
+    case OdbcNativeType::Type::AI_SIGNED_LONG:
+      return &PutNumToNum< Tin, SQLINTEGER >;
+    case OdbcNativeType::Type::AI_UNSIGNED_LONG:
+      return &PutNumToNum< Tin, SQLUINTEGER >;
+    case OdbcNativeType::Type::AI_SIGNED_BIGINT:
+      return &PutNumToNum< Tin, SQLBIGINT >;
+    case OdbcNativeType::Type::AI_UNSIGNED_BIGINT:
+      return &PutNumToNum< Tin, SQLUBIGINT >;
+    case OdbcNativeType::Type::AI_FLOAT:
+      return &PutNumToNum< Tin, SQLREAL >;
+    case OdbcNativeType::Type::AI_DOUBLE:
+      return &PutNumToNum< Tin, SQLDOUBLE >;
+    default:
+      return fallback;
+  }
+}
+
+/**
+ * Get the bulk converter of a number to a numeric buffer.
+ *
+ * @param target C type of the buffer.
+ * @return Bulk converter, or nullptr for the other targets.
+ */
+template < typename Tin >
+ConversionPlan::BulkConverter ResolveNumBulk(OdbcNativeType::Type target) {
+  switch (target) {
+    case OdbcNativeType::Type::AI_SIGNED_TINYINT:
+      return &PutNumToNumBulk< Tin, signed char >;
+    case OdbcNativeType::Type::AI_BIT:
+    case OdbcNativeType::Type::AI_UNSIGNED_TINYINT:
+      return &PutNumToNumBulk< Tin, unsigned char >;
+    case OdbcNativeType::Type::AI_SIGNED_SHORT:
+      return &PutNumToNumBulk< Tin, SQLSMALLINT >;
+    case OdbcNativeType::Type::AI_UNSIGNED_SHORT:
+      return &PutNumToNumBulk< Tin, SQLUSMALLINT >;
+    case OdbcNativeType::Type::AI_SIGNED_LONG:
+      return &PutNumToNumBulk< Tin, SQLINTEGER >;
+    case OdbcNativeType::Type::AI_UNSIGNED_LONG:
+      return &PutNumToNumBulk< Tin, SQLUINTEGER >;
+    case OdbcNativeType::Type::AI_SIGNED_BIGINT:
+      return &PutNumToNumBulk< Tin, SQLBIGINT >;
+    case OdbcNativeType::Type::AI_UNSIGNED_BIGINT:
+      return &PutNumToNumBulk< Tin, SQLUBIGINT >;
+    case OdbcNativeType::Type::AI_FLOAT:
+      return &PutNumToNumBulk< Tin, SQLREAL >;
+    case OdbcNativeType::Type::AI_DOUBLE:
+      return &PutNumToNumBulk< Tin, SQLDOUBLE >;
+    default:
+      return nullptr;
+  }
+}
+}  // namespace
+
+ConversionPlan::Converter ConversionPlan::Resolve(
+    ScalarType source, OdbcNativeType::Type target) {
+  switch (source) {
+    case ScalarType::DOUBLE:
+      return ResolveNum< double >(target, &PutDouble);
+    case ScalarType::INT:
+      return ResolveNum< int32_t >(target, &PutInt32);
+    case ScalarType::BOOLEAN:
+      return ResolveNum< int32_t >(target, &PutBoolean);
+    case ScalarType::TIMESTAMP:
+      return target == OdbcNativeType::Type::AI_TTIMESTAMP
+                 ? &PutTimestampToTimestamp
+                 : &PutTimestamp;
+    default:
+      return &Unsupported;
+  }
+}
+
+ConversionPlan::BulkConverter ConversionPlan::ResolveBulk(
+    ScalarType source, OdbcNativeType::Type target) {
+  switch (source) {
+    case ScalarType::DOUBLE:
+      return ResolveNumBulk< double >(target);
+    case ScalarType::INT:
+    case ScalarType::BOOLEAN:
+      return ResolveNumBulk< int32_t >(target);
+    case ScalarType::TIMESTAMP:
+      return target == OdbcNativeType::Type::AI_TTIMESTAMP
+                 ? &PutTimestampToTimestampBulk
+                 : nullptr;
+    default:
+      return nullptr;
+  }
+}
+}  // namespace odbc
+}  // namespace iotsitewise
@@ -0,0 +1,166 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "iotsitewise/odbc/decoded_page.h"
+
+#include <string.h>
+
+#include "iotsitewise/odbc/conversion_plan.h"
+#include "iotsitewise/odbc/iotsitewise_column.h"
+#include "iotsitewise/odbc/log.h"
+#include "iotsitewise/odbc/utility.h"
+
+using Aws::IoTSiteWise::Model::ColumnInfo;
+using Aws::IoTSiteWise::Model::Datum;
+using Aws::IoTSiteWise::Model::ExecuteQueryResult;
+using Aws::IoTSiteWise::Model::Row;
+using Aws::IoTSiteWise::Model::ScalarType;
+using iotsitewise::odbc::app::ConversionResult;
+
+namespace iotsitewise {
+namespace odbc {
+DecodedPage::DecodedPage(ExecuteQueryResult result)
+    : result_(std::move(result)) {
+  const Aws::Vector< ColumnInfo >& columns = result_.GetColumns();
+  columns_.resize(columns.size());
+  for (uint32_t i = 0; i < columns.size(); i++) {
+    if (!columns[i].GetType().ScalarTypeHasBeenSet()) {
+      continue;
+    }
+
+    Column& column = columns_[i];
+    column.type = columns[i].GetType().GetScalarType();
+    switch (column.type) {
+      case ScalarType::DOUBLE:
+      case ScalarType::INT:
+      case ScalarType::BOOLEAN:
+      case ScalarType::TIMESTAMP:
+        column.isDecoded = DecodeColumn(i, column);
+        break;
+      default:
+        // strings are read from the page without being copied
+        break;
+    }
+
+    if (!column.isDecoded) {
+      // release what is decoded, the column is read from the rows
+      column = Column();
+    }
+  }
+}
+
+DecodedPage::DecodedPage(ExecuteQueryResult result,
+                         std::vector< Column > columns)
+    : result_(std::move(result)), columns_(std::move(columns)) {
+  for (Column& column : columns_) {
+    if (!column.isDecoded) {
+      column = Column();
+    }
+  }
+}
+
+ConversionResult::Type DecodedPage::ReadToBuffer(
+    size_t rowIdx, uint32_t columnIdx,
+    app::ApplicationDataBuffer& dataBuf) const {
+  const Column& column = columns_[columnIdx];
+  return ConversionPlan::Resolve(column.type, dataBuf.GetType())(
+      column, rowIdx, dataBuf);
+}
+
+size_t DecodedPage::GetDecodedBytes() const {
+  size_t bytes = columns_.size() * sizeof(Column);
+  for (const Column& column : columns_) {
+    bytes += column.nulls.size() / 8 + column.doubles.size() * sizeof(double)
+             + column.ints.size() * sizeof(int32_t)
+             + column.timestamps.size() * sizeof(Timestamp);
+  }
+  return bytes;
+}
+
+bool DecodedPage::DecodeColumn(uint32_t columnIdx, Column& column) const {
+  const Aws::Vector< Row >& rows = result_.GetRows();
+  column.nulls.reserve(rows.size());
+  switch (column.type) {
+    case ScalarType::DOUBLE:
+      column.doubles.reserve(rows.size());
+      break;
+    case ScalarType::TIMESTAMP:
+      column.timestamps.reserve(rows.size());
+      break;
+    default:
+      column.ints.reserve(rows.size());
+      break;
+  }
+
+  for (const Row& row : rows) {
+    const Aws::Vector< Datum >& data = row.GetData();
+    if (columnIdx >= data.size()) {
+      return false;
+    }
+
+    const Datum& datum = data[columnIdx];
+    bool isNull = !datum.ScalarValueHasBeenSet();
+    if (isNull && !datum.NullValueHasBeenSet()) {
+      // an array or row value is formatted as text
+      return false;
+    }
+    const Aws::String& value = datum.GetScalarValue();
+    if (!AppendValue(column, isNull ? nullptr : value.c_str(), value.size())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool DecodedPage::AppendValue(Column& column, const char* value, size_t len) {
+  bool isNull = value == nullptr;
+  switch (column.type) {
+    case ScalarType::DOUBLE: {
+      double number = 0.0;
+      if (!isNull && !utility::ParseDouble(value, len, number)) {
+        LOG_DEBUG_MSG("Value " << std::string(value, len)
+                               << " is not decoded as double");
+        return false;
+      }
+      column.doubles.push_back(number);
+      break;
+    }
+    case ScalarType::INT: {
+      int32_t number = 0;
+      if (!isNull && !utility::ParseInt32(value, len, number)) {
+        LOG_DEBUG_MSG("Value " << std::string(value, len)
+                               << " is not decoded as int");
+        return false;
+      }
+      column.ints.push_back(number);
+      break;
+    }
+    case ScalarType::BOOLEAN:
+      column.ints.push_back(
+          !isNull && len == 4 && memcmp(value, "true", 4) == 0 ? 1 : 0);
+      break;
+    case ScalarType::TIMESTAMP:
+      column.timestamps.push_back(
+          isNull ? Timestamp() : IoTSiteWiseColumn::ParseTimestamp(value, len));
+      break;
+    default:
+      return false;
+  }
+  column.nulls.push_back(isNull);
+  return true;
+}
+}  // namespace odbc
+}  // namespace iotsitewise
@@ -22,6 +22,7 @@
 #include "iotsitewise/odbc/config/connection_string_parser.h"
 #include <iotsitewise/odbc/authentication/auth_type.h>
 #include <iotsitewise/odbc/log_level.h>
+#include <iotsitewise/odbc/validation_mode.h>
 #include <iotsitewise/odbc/log.h>
 #include "iotsitewise/odbc/system/odbc_constants.h"
 #include "iotsitewise/odbc/utility.h"
@@ -319,6 +320,113 @@ void ReadDsnConfiguration(const char* dsn, Configuration& config,
   if (maxRowPerPage.IsSet() && !config.IsMaxRowPerPageSet()) {
     config.SetMaxRowPerPage(maxRowPerPage.GetValue());
   }
+
+  SettableValue< int32_t > prefetchPages =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::prefetchPages);
+
+  if (prefetchPages.IsSet() && !config.IsPrefetchPagesSet()) {
+    config.SetPrefetchPages(prefetchPages.GetValue());
+  }
+
+  SettableValue< int32_t > metadataCacheSize =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::metadataCacheSize);
+
+  if (metadataCacheSize.IsSet() && !config.IsMetadataCacheSizeSet()) {
+    config.SetMetadataCacheSize(metadataCacheSize.GetValue());
+  }
+
+  SettableValue< int32_t > metadataCacheTTL =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::metadataCacheTTL);
+
+  if (metadataCacheTTL.IsSet() && !config.IsMetadataCacheTTLSet()) {
+    config.SetMetadataCacheTTL(metadataCacheTTL.GetValue());
+  }
+
+  SettableValue< int32_t > firstPageSize =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::firstPageSize);
+
+  if (firstPageSize.IsSet() && !config.IsFirstPageSizeSet()) {
+    config.SetFirstPageSize(firstPageSize.GetValue());
+  }
+
+  SettableValue< int32_t > pageMemoryBudget =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::pageMemoryBudget);
+
+  if (pageMemoryBudget.IsSet() && !config.IsPageMemoryBudgetSet()) {
+    config.SetPageMemoryBudget(pageMemoryBudget.GetValue());
+  }
+
+  SettableValue< int32_t > resultCacheTTL =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::resultCacheTTL);
+
+  if (resultCacheTTL.IsSet() && !config.IsResultCacheTTLSet()) {
+    config.SetResultCacheTTL(resultCacheTTL.GetValue());
+  }
+
+  SettableValue< int32_t > resultCacheSize =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::resultCacheSize);
+
+  if (resultCacheSize.IsSet() && !config.IsResultCacheSizeSet()) {
+    config.SetResultCacheSize(resultCacheSize.GetValue());
+  }
+
+  SettableValue< bool > queryCoalescing =
+      ReadDsnBool(dsn, ConnectionStringParser::Key::queryCoalescing);
+
+  if (queryCoalescing.IsSet() && !config.IsQueryCoalescingSet()) {
+    config.SetQueryCoalescing(queryCoalescing.GetValue());
+  }
+
+  SettableValue< bool > nestedValuesAsJson =
+      ReadDsnBool(dsn, ConnectionStringParser::Key::nestedValuesAsJson);
+
+  if (nestedValuesAsJson.IsSet() && !config.IsNestedValuesAsJsonSet()) {
+    config.SetNestedValuesAsJson(nestedValuesAsJson.GetValue());
+  }
+
+  SettableValue< bool > logAsync =
+      ReadDsnBool(dsn, ConnectionStringParser::Key::logAsync);
+
+  if (logAsync.IsSet() && !config.IsLogAsyncSet()) {
+    config.SetLogAsync(logAsync.GetValue());
+  }
+
+  SettableValue< int32_t > logQueueSize =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::logQueueSize);
+
+  if (logQueueSize.IsSet() && !config.IsLogQueueSizeSet()) {
+    config.SetLogQueueSize(logQueueSize.GetValue());
+  }
+
+  SettableValue< bool > logDropWhenFull =
+      ReadDsnBool(dsn, ConnectionStringParser::Key::logDropWhenFull);
+
+  if (logDropWhenFull.IsSet() && !config.IsLogDropWhenFullSet()) {
+    config.SetLogDropWhenFull(logDropWhenFull.GetValue());
+  }
+
+  SettableValue< bool > rawResponseDecoding =
+      ReadDsnBool(dsn, ConnectionStringParser::Key::rawResponseDecoding);
+
+  if (rawResponseDecoding.IsSet() && !config.IsRawResponseDecodingSet()) {
+    config.SetRawResponseDecoding(rawResponseDecoding.GetValue());
+  }
+
+  SettableValue< std::string > connectionValidation =
+      ReadDsnString(dsn, ConnectionStringParser::Key::connectionValidation);
+
+  if (connectionValidation.IsSet() && !config.IsConnectionValidationSet()) {
+    ValidationMode::Type mode = ValidationMode::FromString(
+        connectionValidation.GetValue(), ValidationMode::Type::FULL);
+    config.SetConnectionValidation(mode);
+  }
+
+  SettableValue< bool > samlCredentialsCache =
+      ReadDsnBool(dsn, ConnectionStringParser::Key::samlCredentialsCache);
+
+  if (samlCredentialsCache.IsSet() && !config.IsSAMLCredentialsCacheSet()) {
+    config.SetSAMLCredentialsCache(samlCredentialsCache.GetValue());
+  }
 }
 
 bool WriteDsnConfiguration(const config::Configuration& config,
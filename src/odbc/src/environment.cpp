@@ -28,7 +28,10 @@
 namespace iotsitewise {
 namespace odbc {
 Environment::Environment()
-    : connections(), odbcVersion(SQL_OV_ODBC3), odbcNts(SQL_TRUE) {
+    : connections(),
+      odbcVersion(SQL_OV_ODBC3),
+      odbcNts(SQL_TRUE),
+      threadPool(ThreadPool::GetInstance()) {
 }
 
 Environment::~Environment() {
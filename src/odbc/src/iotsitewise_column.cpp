@@ -18,6 +18,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <cctype>
 #include <chrono>
 #include <ctime>
 #include <time.h>
@@ -30,14 +31,16 @@ using iotsitewise::odbc::type_traits::OdbcNativeType;
 
 namespace iotsitewise {
 namespace odbc {
-#define BUFFER_SIZE 1024
 
 IoTSiteWiseColumn::IoTSiteWiseColumn(
                                    uint32_t columnIdx,
-                                   const meta::ColumnMeta& columnMeta)
+                                   const meta::ColumnMeta& columnMeta,
+                                   bool nestedAsJson)
     :
       columnIdx_(columnIdx), 
-      columnMeta_(columnMeta) {
+      columnMeta_(columnMeta),
+      nestedAsJson_(nestedAsJson),
+      serializedDatum_(nullptr) {
 }
 
 ConversionResult::Type IoTSiteWiseColumn::ReadToBuffer(const Datum& datum, ApplicationDataBuffer& dataBuf) const {
@@ -62,10 +65,8 @@ ConversionResult::Type IoTSiteWiseColumn::ParseDatum(
   ConversionResult::Type retval = ConversionResult::Type::AI_FAILURE;
   if (datum.ScalarValueHasBeenSet()) {
     retval = ParseScalarType(datum, dataBuf);
-  } else if (datum.ArrayValueHasBeenSet()) {
-    retval = ParseArrayType(datum, dataBuf);
-  } else if (datum.RowValueHasBeenSet()) {
-    retval = ParseRowType(datum, dataBuf);
+  } else if (datum.ArrayValueHasBeenSet() || datum.RowValueHasBeenSet()) {
+    retval = ParseNestedType(datum, dataBuf);
   } else if (datum.NullValueHasBeenSet()) {
     dataBuf.PutNull();
     retval = ConversionResult::Type::AI_SUCCESS;
@@ -81,7 +82,7 @@ ConversionResult::Type IoTSiteWiseColumn::ParseScalarType(
     ApplicationDataBuffer& dataBuf) const {
   LOG_DEBUG_MSG("ParseScalarType is called");
 
-  Aws::String value = datum.GetScalarValue();
+  const Aws::String& value = datum.GetScalarValue();
   LOG_DEBUG_MSG("value is " << value << ", scalar type is "
                             << static_cast< int >(columnMeta_.GetScalarType()));
 
@@ -91,47 +92,37 @@ ConversionResult::Type IoTSiteWiseColumn::ParseScalarType(
     case ScalarType::STRING:
       convRes = dataBuf.PutString(value);
       break;
-    case ScalarType::DOUBLE:
-      // There could be a precision problem for stod as double can not be
-      // represented in binary form using finite precision. For example for
-      // double value 35.2 in string, std::stod("35.2") could
-      // return 35.200000000000003 on Windows. These rounding errors are a
-      // common issue in floating-point arithmetic and can not be avoided.
-      convRes = dataBuf.PutDouble(std::stod(value));
+    case ScalarType::DOUBLE: {
+      // The value is parsed to the closest double, which may still differ
+      // from the decimal string, e.g. 35.2 is 35.200000000000003. These
+      // rounding errors are a common issue in floating-point arithmetic and
+      // can not be avoided.
+      double number = 0.0;
+      if (!utility::ParseDouble(value.c_str(), value.size(), number)) {
+        LOG_ERROR_MSG("Failed to convert " << value << " to double");
+        return ConversionResult::Type::AI_FAILURE;
+      }
+      convRes = dataBuf.PutDouble(number);
       break;
+    }
     case ScalarType::BOOLEAN:
       convRes = dataBuf.PutInt8(value == "true" ? 1 : 0);
       break;
-    case ScalarType::INT:
-      convRes = dataBuf.PutInt32(utility::StringToInt(value));
+    case ScalarType::INT: {
+      int32_t number = 0;
+      if (!utility::ParseInt32(value.c_str(), value.size(), number)) {
+        LOG_ERROR_MSG("Failed to convert " << value << " to int");
+        return ConversionResult::Type::AI_FAILURE;
+      }
+      convRes = dataBuf.PutInt32(number);
       break;
+    }
     case ScalarType::NOT_SET:
       convRes = dataBuf.PutNull();
       break;
-    case ScalarType::TIMESTAMP: {
-      tm tmTime;
-      memset(&tmTime, 0, sizeof(tm));
-      int32_t fractionNs;
-      std::sscanf(value.c_str(), "%4d-%2d-%2d %2d:%2d:%2d.%9d", &tmTime.tm_year,
-                  &tmTime.tm_mon, &tmTime.tm_mday, &tmTime.tm_hour,
-                  &tmTime.tm_min, &tmTime.tm_sec, &fractionNs);
-      tmTime.tm_year -= 1900;
-      tmTime.tm_mon--;
-#ifdef _WIN32
-      int64_t seconds = _mkgmtime(&tmTime);
-#else
-      int64_t seconds = timegm(&tmTime);
-#endif
-      LOG_DEBUG_MSG("timestamp is " << tmTime.tm_year << " " << tmTime.tm_mon
-                                    << " " << tmTime.tm_mday << " "
-                                    << tmTime.tm_hour << ":" << tmTime.tm_min
-                                    << ":" << tmTime.tm_sec << "."
-                                    << fractionNs);
-
-      LOG_DEBUG_MSG("seconds is " << seconds);
-      convRes = dataBuf.PutTimestamp(Timestamp(seconds, fractionNs));
+    case ScalarType::TIMESTAMP:
+      convRes = dataBuf.PutTimestamp(ParseTimestamp(value));
       break;
-    }
     default:
       return ConversionResult::Type::AI_UNSUPPORTED_CONVERSION;
   }
@@ -140,71 +131,242 @@ ConversionResult::Type IoTSiteWiseColumn::ParseScalarType(
   return convRes;
 }
 
-ConversionResult::Type IoTSiteWiseColumn::ParseArrayType(
-    const Datum& datum, ApplicationDataBuffer& dataBuf) const {
-  LOG_DEBUG_MSG("ParseArrayType is called");
-
-  const Aws::Vector< Datum >& valueVec = datum.GetArrayValue();
+Timestamp IoTSiteWiseColumn::ParseTimestamp(const Aws::String& value) {
+  return ParseTimestamp(value.c_str(), value.size());
+}
 
-  std::string result("");
-  if (valueVec.empty()) {
-    result = "";
-  } else {
-    result = "[";
-    for (const auto& itr : valueVec) {
-      char buf[BUFFER_SIZE]{};
-      SqlLen resLen;
-      ApplicationDataBuffer tmpBuf(OdbcNativeType::Type::AI_CHAR,
-                                   static_cast< void* >(buf), BUFFER_SIZE,
-                                   &resLen);
-      ParseDatum(itr, tmpBuf);
-      result += buf;
-
-      result += ",";
-    }
-    result.pop_back();
-    result += "]";
+Timestamp IoTSiteWiseColumn::ParseTimestamp(const char* text, size_t len) {
+  int64_t seconds = 0;
+  int32_t fractionNs = 0;
+  if (utility::ParseUtcTimestamp(text, len, seconds, fractionNs)) {
+    return Timestamp(seconds, fractionNs);
   }
 
-  ConversionResult::Type convRes = dataBuf.PutString(result);
-
-  LOG_DEBUG_MSG("convRes is " << static_cast< int >(convRes));
-  return convRes;
+  // sscanf needs a null-terminated string
+  Aws::String value(text, len);
+  LOG_DEBUG_MSG("Timestamp " << value << " is not in the expected format");
+  tm tmTime;
+  memset(&tmTime, 0, sizeof(tm));
+  std::sscanf(value.c_str(), "%4d-%2d-%2d %2d:%2d:%2d.%9d", &tmTime.tm_year,
+              &tmTime.tm_mon, &tmTime.tm_mday, &tmTime.tm_hour, &tmTime.tm_min,
+              &tmTime.tm_sec, &fractionNs);
+  tmTime.tm_year -= 1900;
+  tmTime.tm_mon--;
+#ifdef _WIN32
+  seconds = _mkgmtime(&tmTime);
+#else
+  seconds = timegm(&tmTime);
+#endif
+  return Timestamp(seconds, fractionNs);
 }
 
-ConversionResult::Type IoTSiteWiseColumn::ParseRowType(
+ConversionResult::Type IoTSiteWiseColumn::ParseNestedType(
     const Datum& datum, ApplicationDataBuffer& dataBuf) const {
-  LOG_DEBUG_MSG("ParseRowType is called");
+  LOG_DEBUG_MSG("ParseNestedType is called");
 
-  const Row& row = datum.GetRowValue();
-
-  if (!row.DataHasBeenSet()) {
+  if (datum.RowValueHasBeenSet() && !datum.GetRowValue().DataHasBeenSet()) {
     LOG_DEBUG_MSG("No data is set for the row");
     return ConversionResult::Type::AI_NO_DATA;
   }
 
-  const Aws::Vector< Datum >& valueVec = row.GetData();
-  std::string result = "(";
-  for (const auto& itr : valueVec) {
-    char buf[BUFFER_SIZE]{};
-    SqlLen resLen;
-    ApplicationDataBuffer tmpBuf(OdbcNativeType::Type::AI_CHAR,
-                                 static_cast< void* >(buf), BUFFER_SIZE,
-                                 &resLen);
-    ParseDatum(itr, tmpBuf);
-    result += buf;
-
-    result += ",";
-  }
-  if (!valueVec.empty()) {
-    result.pop_back();
+  // SQLGetData reads a large value in parts from the same datum
+  if (serializedDatum_ != &datum) {
+    serializedDatum_ = nullptr;
+    serialized_.clear();
+    if (nestedAsJson_) {
+      WriteJson(datum, serialized_);
+    } else {
+      WriteText(datum, serialized_);
+    }
+    serializedDatum_ = &datum;
   }
-  result += ")";
 
-  ConversionResult::Type convRes = dataBuf.PutString(result);
+  ConversionResult::Type convRes = dataBuf.PutString(serialized_);
 
   LOG_DEBUG_MSG("convRes is " << static_cast< int >(convRes));
   return convRes;
 }
+
+void IoTSiteWiseColumn::WriteText(const Datum& datum,
+                                  std::string& out) const {
+  if (datum.ScalarValueHasBeenSet()) {
+    const Aws::String& value = datum.GetScalarValue();
+    switch (columnMeta_.GetScalarType()) {
+      case ScalarType::STRING:
+        out.append(value.data(), value.size());
+        break;
+      case ScalarType::NOT_SET:
+        break;
+      default: {
+        // a formatted number or timestamp is short
+        char buf[64]{};
+        SqlLen resLen = 0;
+        ApplicationDataBuffer tmpBuf(OdbcNativeType::Type::AI_CHAR,
+                                     static_cast< void* >(buf), sizeof(buf),
+                                     &resLen);
+        if (ParseScalarType(datum, tmpBuf)
+            == ConversionResult::Type::AI_SUCCESS) {
+          out += buf;
+        }
+        break;
+      }
+    }
+  } else if (datum.ArrayValueHasBeenSet()) {
+    const Aws::Vector< Datum >& valueVec = datum.GetArrayValue();
+    if (valueVec.empty()) {
+      return;
+    }
+    out += '[';
+    for (size_t i = 0; i < valueVec.size(); i++) {
+      if (i > 0) {
+        out += ',';
+      }
+      WriteText(valueVec[i], out);
+    }
+    out += ']';
+  } else if (datum.RowValueHasBeenSet()) {
+    const Row& row = datum.GetRowValue();
+    if (!row.DataHasBeenSet()) {
+      return;
+    }
+    const Aws::Vector< Datum >& valueVec = row.GetData();
+    out += '(';
+    for (size_t i = 0; i < valueVec.size(); i++) {
+      if (i > 0) {
+        out += ',';
+      }
+      WriteText(valueVec[i], out);
+    }
+    out += ')';
+  }
+}
+
+namespace {
+/**
+ * Check if the value is a number in the JSON grammar.
+ *
+ * @param str Value.
+ * @param len Length of the value.
+ * @return @c true if the value can be written as a JSON number.
+ */
+bool IsJsonNumber(const char* str, size_t len) {
+  size_t i = 0;
+  if (i < len && str[i] == '-') {
+    i++;
+  }
+  if (i >= len || !isdigit(static_cast< unsigned char >(str[i]))) {
+    return false;
+  }
+  if (str[i] == '0') {
+    i++;
+  } else {
+    while (i < len && isdigit(static_cast< unsigned char >(str[i]))) {
+      i++;
+    }
+  }
+  if (i < len && str[i] == '.') {
+    i++;
+    size_t start = i;
+    while (i < len && isdigit(static_cast< unsigned char >(str[i]))) {
+      i++;
+    }
+    if (i == start) {
+      return false;
+    }
+  }
+  if (i < len && (str[i] == 'e' || str[i] == 'E')) {
+    i++;
+    if (i < len && (str[i] == '+' || str[i] == '-')) {
+      i++;
+    }
+    size_t start = i;
+    while (i < len && isdigit(static_cast< unsigned char >(str[i]))) {
+      i++;
+    }
+    if (i == start) {
+      return false;
+    }
+  }
+  return i == len;
+}
+
+/**
+ * Append a value as a JSON string.
+ *
+ * @param value Value.
+ * @param out String to append to.
+ */
+void AppendJsonString(const Aws::String& value, std::string& out) {
+  static const char hex[] = "0123456789abcdef";
+  out += '"';
+  for (char c : value) {
+    switch (c) {
+      case '"':
+        out += "\\\"";
+        break;
+      case '\\':
+        out += "\\\\";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      case '\r':
+        out += "\\r";
+        break;
+      case '\t':
+        out += "\\t";
+        break;
+      default:
+        if (static_cast< unsigned char >(c) < 0x20) {
+          out += "\\u00";
+          out += hex[(c >> 4) & 0xF];
+          out += hex[c & 0xF];
+        } else {
+          out += c;
+        }
+        break;
+    }
+  }
+  out += '"';
+}
+}  // namespace
+
+void IoTSiteWiseColumn::WriteJson(const Datum& datum,
+                                  std::string& out) const {
+  if (datum.ScalarValueHasBeenSet()) {
+    const Aws::String& value = datum.GetScalarValue();
+    switch (columnMeta_.GetScalarType()) {
+      case ScalarType::DOUBLE:
+      case ScalarType::INT:
+        if (IsJsonNumber(value.data(), value.size())) {
+          out.append(value.data(), value.size());
+        } else {
+          AppendJsonString(value, out);
+        }
+        break;
+      case ScalarType::BOOLEAN:
+        out += value == "true" ? "true" : "false";
+        break;
+      default:
+        AppendJsonString(value, out);
+        break;
+    }
+  } else if (datum.ArrayValueHasBeenSet() || datum.RowValueHasBeenSet()) {
+    // a row is written as an array of its values
+    const Aws::Vector< Datum >& valueVec =
+        datum.ArrayValueHasBeenSet() ? datum.GetArrayValue()
+                                     : datum.GetRowValue().GetData();
+    out += '[';
+    for (size_t i = 0; i < valueVec.size(); i++) {
+      if (i > 0) {
+        out += ',';
+      }
+      WriteJson(valueVec[i], out);
+    }
+    out += ']';
+  } else {
+    out += "null";
+  }
+}
 }  // namespace odbc
 }  // namespace iotsitewise
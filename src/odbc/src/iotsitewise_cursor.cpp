@@ -20,15 +20,19 @@
 
 #include "iotsitewise/odbc/iotsitewise_cursor.h"
 
+#include <algorithm>
+
 namespace iotsitewise {
 namespace odbc {
 IoTSiteWiseCursor::IoTSiteWiseCursor(
-    const Aws::Vector< Row > rowVec,
-    const meta::ColumnMetaVector& columnMetadataVec)
-    : rowVec_(rowVec),
+    std::shared_ptr< const DecodedPage > page,
+    const meta::ColumnMetaVector& columnMetadataVec, bool nestedAsJson)
+    : page_(std::move(page)),
+      rowVec_(page_->GetRows()),
       iterator_(rowVec_.begin()),
       columnMetadataVec_(columnMetadataVec),
-      curPos_(0) {
+      curPos_(0),
+      nestedAsJson_(nestedAsJson) {
   // No-op.
 }
 
@@ -59,11 +63,76 @@ app::ConversionResult::Type IoTSiteWiseCursor::ReadColumnToBuffer(
     return app::ConversionResult::Type::AI_FAILURE;
   }
 
+  if (page_->IsDecoded(columnIdx - 1)) {
+    // the value is decoded when the page is fetched
+    return page_->ReadToBuffer(curPos_ - 1, columnIdx - 1, dataBuf);
+  }
+
+  IoTSiteWiseColumn& column = GetColumn(columnIdx);
+  const Datum& datum = iterator_->GetData()[columnIdx-1];
+  return column.ReadToBuffer(datum, dataBuf);
+}
+
+app::ConversionResult::Type IoTSiteWiseCursor::ReadColumnToBuffer(
+    uint32_t columnIdx, app::ApplicationDataBuffer& dataBuf,
+    ConversionPlan& plan) {
+  LOG_DEBUG_MSG("ReadColumnToBuffer is called");
+  if (!EnsureColumnDiscovered(columnIdx)) {
+    LOG_ERROR_MSG("columnIdx could not be discovered for index " << columnIdx);
+    return app::ConversionResult::Type::AI_FAILURE;
+  }
+
+  if (page_->IsDecoded(columnIdx - 1)) {
+    const DecodedPage::Column& column = page_->GetColumn(columnIdx - 1);
+    return plan.Get(columnIdx, column.type, dataBuf.GetType())(
+        column, curPos_ - 1, dataBuf);
+  }
+
   IoTSiteWiseColumn& column = GetColumn(columnIdx);
   const Datum& datum = iterator_->GetData()[columnIdx-1];
   return column.ReadToBuffer(datum, dataBuf);
 }
 
+void IoTSiteWiseCursor::ReadColumnToBuffers(
+    uint32_t columnIdx, app::ApplicationDataBuffer& dataBuf,
+    SqlUlen firstElement, size_t rowCount, ConversionPlan& plan,
+    app::ConversionResult::Type* results) {
+  LOG_DEBUG_MSG("ReadColumnToBuffers is called for " << rowCount << " rows");
+  if (!EnsureColumnDiscovered(columnIdx)) {
+    LOG_ERROR_MSG("columnIdx could not be discovered for index " << columnIdx);
+    std::fill(results, results + rowCount,
+              app::ConversionResult::Type::AI_FAILURE);
+    return;
+  }
+
+  size_t firstRow = curPos_ - 1;
+  if (page_->IsDecoded(columnIdx - 1)) {
+    const DecodedPage::Column& column = page_->GetColumn(columnIdx - 1);
+    ConversionPlan::BulkConverter bulkConverter =
+        plan.GetBulk(columnIdx, column.type, dataBuf.GetType());
+    if (bulkConverter) {
+      dataBuf.SetElementOffset(firstElement);
+      bulkConverter(column, firstRow, rowCount, dataBuf, results);
+      return;
+    }
+
+    ConversionPlan::Converter converter =
+        plan.Get(columnIdx, column.type, dataBuf.GetType());
+    for (size_t i = 0; i < rowCount; i++) {
+      dataBuf.SetElementOffset(firstElement + i);
+      results[i] = converter(column, firstRow + i, dataBuf);
+    }
+    return;
+  }
+
+  IoTSiteWiseColumn& column = GetColumn(columnIdx);
+  for (size_t i = 0; i < rowCount; i++) {
+    dataBuf.SetElementOffset(firstElement + i);
+    const Datum& datum = rowVec_[firstRow + i].GetData()[columnIdx - 1];
+    results[i] = column.ReadToBuffer(datum, dataBuf);
+  }
+}
+
 bool IoTSiteWiseCursor::EnsureColumnDiscovered(uint32_t columnIdx) {
   LOG_DEBUG_MSG("EnsureColumnDiscovered is called for column " << columnIdx);
   if (columnIdx > columnMetadataVec_.size() || columnIdx < 1) {
@@ -80,7 +149,8 @@ bool IoTSiteWiseCursor::EnsureColumnDiscovered(uint32_t columnIdx) {
 
   uint32_t index = columns_.size();
   while (index < columnIdx) {
-    IoTSiteWiseColumn newColumn(index, columnMetadataVec_[index]);
+    IoTSiteWiseColumn newColumn(index, columnMetadataVec_[index],
+                                nestedAsJson_);
 
     columns_.push_back(newColumn);
     index++;
@@ -28,6 +28,7 @@
 #include <unistd.h>
 #endif
 
+#include <chrono>
 #include <cstdlib>
 
 #include "iotsitewise/odbc/config/configuration.h"
@@ -40,8 +41,19 @@ using iotsitewise::odbc::config::Configuration;
 
 // logger_ pointer will  initialized in first call to GetLoggerInstance
 std::shared_ptr< Logger > Logger::logger_;
+std::atomic< int > Logger::cachedLogLevel_(
+    static_cast< int >(iotsitewise::odbc::LogLevel::Type::WARNING_LEVEL));
 CriticalSection Logger::mutexForCreation;
 
+// Maximum number of queued messages written before the file is flushed
+#define ASYNC_LOG_BATCH_SIZE 1024
+
+// Interval the background writer checks the queue when it is idle
+#define ASYNC_LOG_WAIT_MS 100
+
+// Messages longer than this are not kept by the background writer buffer
+#define ASYNC_LOG_MAX_KEPT_SIZE 4096
+
 namespace iotsitewise {
 namespace odbc {
 LogStream::LogStream(Logger* parent)
@@ -59,6 +71,25 @@ LogStream::~LogStream() {
   }
 }
 
+Logger::~Logger() {
+  {
+    std::lock_guard< std::mutex > lock(asyncHoldersMutex);
+    isAsync = false;
+  }
+  if (asyncWriter.joinable()) {
+    // the messages being queued are written before the writer stops
+    while (asyncProducers.load() > 0) {
+      std::this_thread::yield();
+    }
+    {
+      std::lock_guard< std::mutex > lock(asyncMutex);
+      isAsyncStopping = true;
+    }
+    asyncCv.notify_one();
+    asyncWriter.join();
+  }
+}
+
 std::string Logger::GetDefaultLogPath() {
   std::string defPath;
 #if defined(PREDEF_PLATFORM_UNIX_OR_APPLE)
@@ -140,6 +171,7 @@ void Logger::SetLogStream(std::ostream* logStream) {
 
 void Logger::SetLogLevel(LogLevel::Type level) {
   logLevel = level;
+  cachedLogLevel_.store(static_cast< int >(level), std::memory_order_relaxed);
 }
 
 bool Logger::IsFileStreamOpen() const {
@@ -180,11 +212,128 @@ bool Logger::EnableLog() {
 
 void Logger::WriteMessage(std::string const& message) {
   if (IsEnabled()) {
+    // the messages to other streams are written right away
+    if (stream == &fileStream && QueueMessage(message)) {
+      return;
+    }
     CsLockGuard guard(mutex);
     *stream << message << std::endl;
   }
 }
 
+bool Logger::QueueMessage(std::string const& message) {
+  // StopAsync waits for the producers that have seen the writer running
+  ++asyncProducers;
+  if (!isAsync.load()) {
+    --asyncProducers;
+    return false;
+  }
+
+  std::string queued(message);
+  while (!asyncQueue->TryPush(queued)) {
+    if (asyncDropWhenFull) {
+      ++droppedMessages;
+      break;
+    }
+    // wait for the writer to make room
+    asyncCv.notify_one();
+    std::this_thread::yield();
+  }
+  if (isWriterSleeping.load()) {
+    asyncCv.notify_one();
+  }
+  --asyncProducers;
+  return true;
+}
+
+void Logger::StartAsync(size_t queueSize, bool dropWhenFull) {
+  std::lock_guard< std::mutex > lock(asyncHoldersMutex);
+  if (asyncHolders++ > 0) {
+    return;
+  }
+
+  LOG_DEBUG_MSG("Starting the background log writer, queue size is "
+                << queueSize << ", drop when full is " << dropWhenFull);
+  asyncQueue.reset(new AsyncLogQueue(queueSize));
+  asyncDropWhenFull = dropWhenFull;
+  isAsyncStopping = false;
+  asyncWriter = std::thread(&Logger::RunAsyncWriter, this);
+  isAsync = true;
+}
+
+void Logger::StopAsync() {
+  std::lock_guard< std::mutex > lock(asyncHoldersMutex);
+  if (asyncHolders == 0 || --asyncHolders > 0) {
+    return;
+  }
+
+  isAsync = false;
+  // the messages being queued are written before the writer stops
+  while (asyncProducers.load() > 0) {
+    std::this_thread::yield();
+  }
+  {
+    std::lock_guard< std::mutex > asyncLock(asyncMutex);
+    isAsyncStopping = true;
+  }
+  asyncCv.notify_one();
+  asyncWriter.join();
+  asyncQueue.reset();
+  LOG_DEBUG_MSG("The background log writer is stopped");
+}
+
+void Logger::RunAsyncWriter() {
+  std::string message;
+  for (;;) {
+    if (WriteQueuedMessages(message, ASYNC_LOG_BATCH_SIZE) > 0) {
+      continue;
+    }
+
+    std::unique_lock< std::mutex > lock(asyncMutex);
+    if (isAsyncStopping) {
+      lock.unlock();
+      // the producers have finished before the stop, but may have queued
+      // messages since the queue was found empty
+      while (WriteQueuedMessages(message, ASYNC_LOG_BATCH_SIZE) > 0) {
+        // No-op.
+      }
+      break;
+    }
+    isWriterSleeping = true;
+    asyncCv.wait_for(lock, std::chrono::milliseconds(ASYNC_LOG_WAIT_MS));
+    isWriterSleeping = false;
+  }
+}
+
+size_t Logger::WriteQueuedMessages(std::string& message, size_t maxCount) {
+  size_t dropped = droppedMessages.exchange(0);
+  bool popped = asyncQueue->TryPop(message);
+  if (!popped && dropped == 0) {
+    return 0;
+  }
+
+  if (!IsFileStreamOpen()) {
+    EnableLog();
+  }
+
+  size_t count = 0;
+  CsLockGuard guard(mutex);
+  if (dropped > 0) {
+    fileStream << "WARNING MSG: " << dropped
+               << " log messages were dropped, the log queue is full\n";
+  }
+  while (popped) {
+    fileStream << message << '\n';
+    if (message.capacity() > ASYNC_LOG_MAX_KEPT_SIZE) {
+      std::string().swap(message);
+    }
+    popped = ++count < maxCount && asyncQueue->TryPop(message);
+  }
+  // one flush per batch instead of one per message
+  fileStream.flush();
+  return count;
+}
+
 LogLevel::Type Logger::GetLogLevel() const {
   return logLevel;
 }
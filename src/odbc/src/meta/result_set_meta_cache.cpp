@@ -0,0 +1,160 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "iotsitewise/odbc/meta/result_set_meta_cache.h"
+
+#include <cctype>
+
+#include "iotsitewise/odbc/log.h"
+
+namespace iotsitewise {
+namespace odbc {
+namespace meta {
+ResultSetMetaCache::ResultSetMetaCache(size_t capacity, int32_t ttl)
+    : capacity_(capacity), ttl_(ttl), hits_(0), misses_(0) {
+  // No-op.
+}
+
+void ResultSetMetaCache::Configure(size_t capacity, int32_t ttl) {
+  std::lock_guard< std::mutex > lock(mutex_);
+  capacity_ = capacity;
+  ttl_ = ttl;
+  entries_.clear();
+  index_.clear();
+}
+
+bool ResultSetMetaCache::Get(const std::string& sql, ColumnMetaVector& meta) {
+  std::lock_guard< std::mutex > lock(mutex_);
+  if (capacity_ == 0) {
+    return false;
+  }
+
+  std::unordered_map< std::string, EntryList::iterator >::iterator it =
+      index_.find(Normalize(sql));
+  if (it == index_.end()) {
+    misses_++;
+    return false;
+  }
+
+  if (ttl_ > 0 && Clock::now() >= it->second->expiry) {
+    LOG_DEBUG_MSG("Cached metadata is expired for query " << sql);
+    entries_.erase(it->second);
+    index_.erase(it);
+    misses_++;
+    return false;
+  }
+
+  // move the entry to the front as the most recently used one
+  entries_.splice(entries_.begin(), entries_, it->second);
+  meta = it->second->meta;
+  hits_++;
+  return true;
+}
+
+void ResultSetMetaCache::Put(const std::string& sql,
+                             const ColumnMetaVector& meta) {
+  std::lock_guard< std::mutex > lock(mutex_);
+  if (capacity_ == 0) {
+    return;
+  }
+
+  std::string key = Normalize(sql);
+  Clock::time_point expiry = Clock::now() + std::chrono::seconds(ttl_);
+
+  std::unordered_map< std::string, EntryList::iterator >::iterator it =
+      index_.find(key);
+  if (it != index_.end()) {
+    it->second->expiry = expiry;
+    it->second->meta = meta;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return;
+  }
+
+  if (entries_.size() >= capacity_) {
+    // evict the least recently used entry
+    index_.erase(entries_.back().key);
+    entries_.pop_back();
+  }
+
+  Entry entry;
+  entry.key = key;
+  entry.expiry = expiry;
+  entry.meta = meta;
+  entries_.push_front(std::move(entry));
+  index_[key] = entries_.begin();
+}
+
+void ResultSetMetaCache::Clear() {
+  std::lock_guard< std::mutex > lock(mutex_);
+  entries_.clear();
+  index_.clear();
+}
+
+uint64_t ResultSetMetaCache::GetHits() const {
+  std::lock_guard< std::mutex > lock(mutex_);
+  return hits_;
+}
+
+uint64_t ResultSetMetaCache::GetMisses() const {
+  std::lock_guard< std::mutex > lock(mutex_);
+  return misses_;
+}
+
+size_t ResultSetMetaCache::GetSize() const {
+  std::lock_guard< std::mutex > lock(mutex_);
+  return entries_.size();
+}
+
+std::string ResultSetMetaCache::Normalize(const std::string& sql) {
+  std::string res;
+  res.reserve(sql.size());
+
+  char quote = 0;
+  bool pendingSpace = false;
+  for (char c : sql) {
+    if (quote) {
+      res.push_back(c);
+      if (c == quote) {
+        quote = 0;
+      }
+      continue;
+    }
+
+    if (std::isspace(static_cast< unsigned char >(c))) {
+      pendingSpace = !res.empty();
+      continue;
+    }
+
+    if (pendingSpace) {
+      res.push_back(' ');
+      pendingSpace = false;
+    }
+    if (c == '\'' || c == '"') {
+      quote = c;
+    }
+    res.push_back(c);
+  }
+
+  while (quote == 0 && !res.empty()
+         && (res.back() == ';' || res.back() == ' ')) {
+    res.pop_back();
+  }
+
+  return res;
+}
+}  // namespace meta
+}  // namespace odbc
+}  // namespace iotsitewise
@@ -24,13 +24,17 @@
 #include "iotsitewise/odbc/log.h"
 #include "ignite/odbc/odbc_error.h"
 
+#include <aws/core/http/HttpRequest.h>
 #include <aws/iotsitewise/model/ColumnType.h>
 
+#include <algorithm>
+
 namespace iotsitewise {
 namespace odbc {
 namespace query {
 DataQuery::DataQuery(diagnostic::DiagnosableAdapter& diag,
-                     Connection& connection, const std::string& sql)
+                     Connection& connection, const std::string& sql,
+                     size_t prefetchPages)
     : Query(diag, iotsitewise::odbc::query::QueryType::DATA),
       connection_(connection),
       sql_(sql),
@@ -38,8 +42,22 @@ DataQuery::DataQuery(diagnostic::DiagnosableAdapter& diag,
       resultMeta_(),
       request_(),
       result_(nullptr),
+      describeResult_(nullptr),
       cursor_(nullptr),
       client_(connection.GetClient()),
+      prefetchPages_(prefetchPages > 0 ? prefetchPages : 1),
+      threadPool_(ThreadPool::GetInstance()),
+      queryTimeout_(0),
+      maxRows_(0),
+      firstPageSize_(0),
+      control_(std::make_shared< ExecutionControl >(0)),
+      cacheKey_(),
+      cachedPages_(),
+      cachedPage_(0),
+      isRecording_(false),
+      recordedPages_(),
+      recordedBytes_(0),
+      stream_(nullptr),
       hasAsyncFetch(false),
       rowCounter(0) {
   // No-op.
@@ -86,6 +104,12 @@ SqlResult::Type DataQuery::Cancel() {
 const meta::ColumnMetaVector* DataQuery::GetMeta() {
   LOG_DEBUG_MSG("GetMeta is called");
 
+  if (!resultMetaAvailable_
+      && connection_.GetMetaCache().Get(sql_, resultMeta_)) {
+    LOG_DEBUG_MSG("Result set metadata is found in cache");
+    resultMetaAvailable_ = true;
+  }
+
   if (!resultMetaAvailable_) {
     MakeRequestResultsetMeta();
 
@@ -100,62 +124,239 @@ const meta::ColumnMetaVector* DataQuery::GetMeta() {
 }
 
 /**
- * Fetch one page asynchronously. It will be
- * executed in an asynchronous thread.
+ * Estimate memory taken by a value.
+ *
+ * @param datum Value.
+ * @return Estimated size in bytes.
+ */
+size_t EstimateDatumBytes(const Datum& datum) {
+  size_t bytes = sizeof(datum) + datum.GetScalarValue().size();
+  for (const Datum& item : datum.GetArrayValue()) {
+    bytes += EstimateDatumBytes(item);
+  }
+  for (const Datum& item : datum.GetRowValue().GetData()) {
+    bytes += EstimateDatumBytes(item);
+  }
+  return bytes;
+}
+
+/**
+ * Estimate memory taken by the rows of a page from its first rows, and by
+ * its decoded values.
+ *
+ * @param page Page.
+ * @return Estimated size in bytes.
+ */
+size_t EstimatePageBytes(const DecodedPage& page) {
+  const Aws::Vector< Row >& rows = page.GetRows();
+  size_t sampled = std::min< size_t >(rows.size(), 16);
+  if (sampled == 0) {
+    return 0;
+  }
+
+  size_t bytes = 0;
+  for (size_t i = 0; i < sampled; i++) {
+    for (const Datum& datum : rows[i].GetData()) {
+      bytes += EstimateDatumBytes(datum);
+    }
+  }
+  return bytes * rows.size() / sampled + page.GetDecodedBytes();
+}
+
+/** Rows of the page fetched by a describe request. */
+const int DESCRIBE_PAGE_SIZE = 1;
+
+/** Milliseconds the page of a describe request may be reused. */
+const int64_t DESCRIBE_REUSE_MILLIS = 5000;
+
+/**
+ * Get milliseconds passed since a point of time.
+ *
+ * @param start Point of time.
+ * @return Milliseconds passed.
+ */
+int64_t MillisecondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast< std::chrono::milliseconds >(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+/**
+ * Cap the page size of a request to the number of rows still wanted.
+ *
+ * @param request Request to update.
+ * @param rows Number of rows still wanted.
+ */
+void CapMaxResults(ExecuteQueryRequest& request, size_t rows) {
+  int cap = rows < static_cast< size_t >(INT32_MAX) ? static_cast< int >(rows)
+                                                   : INT32_MAX;
+  if (!request.MaxResultsHasBeenSet() || request.GetMaxResults() > cap) {
+    request.SetMaxResults(cap);
+  }
+}
+
+/**
+ * Fetch one page asynchronously. It will be executed by a thread pool
+ * worker and schedules itself again as long as context_.queue_ has a
+ * free slot, otherwise fetching is paused until the cursor consumes a page.
  *
  * @return void.
  */
 void AsyncFetchOnePage(
-    const std::shared_ptr< Aws::IoTSiteWise::IoTSiteWiseClient > client,
-    const ExecuteQueryRequest& request, DataQueryContext& context_) {
+    const std::shared_ptr< QueryClient > client,
+    ThreadPool* pool, const void* owner, DataQueryContext& context_) {
   LOG_DEBUG_MSG("AsyncFetchOnePage is called");
-  Aws::IoTSiteWise::Model::ExecuteQueryOutcome result;
-  result = client->ExecuteQuery(request);
+  {
+    std::lock_guard< std::mutex > locker(context_.mutex_);
+    if (context_.isClosing_) {
+      LOG_DEBUG_MSG("Main thread is exiting, stop fetching");
+      context_.isFetching_ = false;
+      context_.cv_.notify_all();
+      return;
+    }
+  }
+
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  // the page is decoded here, so the cursor only copies the values
+  PageOutcome outcome = client->ExecuteQueryPage(context_.request_);
+  int64_t latency = MillisecondsSince(start);
+  size_t bytes = 0;
+  if (context_.pageSize_ && outcome.IsSuccess()) {
+    bytes = EstimatePageBytes(*outcome.GetResult());
+  }
+
+  std::lock_guard< std::mutex > locker(context_.mutex_);
+  if (context_.isClosing_) {
+    LOG_DEBUG_MSG("Main thread is exiting, drop the fetched page");
+    context_.isFetching_ = false;
+    context_.cv_.notify_all();
+    return;
+  }
+
+  bool isLastPage = !outcome.IsSuccess()
+                    || outcome.GetResult()->GetNextToken().empty();
+  if (outcome.IsSuccess() && context_.pageSize_) {
+    context_.pageSize_->Update(outcome.GetResult()->GetRows().size(), bytes,
+                               latency);
+    context_.request_.SetMaxResults(context_.pageSize_->GetPageSize());
+  }
+  if (outcome.IsSuccess() && context_.rowLimit_ > 0) {
+    context_.rowsFetched_ += outcome.GetResult()->GetRows().size();
+    if (context_.rowsFetched_ >= context_.rowLimit_) {
+      LOG_DEBUG_MSG("Row limit " << context_.rowLimit_
+                                 << " is reached, stop fetching");
+      isLastPage = true;
+    } else {
+      CapMaxResults(context_.request_,
+                    context_.rowLimit_ - context_.rowsFetched_);
+    }
+  }
+  if (isLastPage) {
+    context_.hasMorePages_ = false;
+    context_.queue_.push(std::move(outcome));
+  } else {
+    context_.request_.SetNextToken(outcome.GetResult()->GetNextToken());
+    // skip the empty page as there are more pages to come
+    if (!outcome.GetResult()->GetRows().empty()) {
+      context_.queue_.push(std::move(outcome));
+    }
+  }
+  LOG_DEBUG_MSG("Result queue has " << context_.queue_.size() << " pages");
 
-  std::unique_lock< std::mutex > locker(context_.mutex_);
-  context_.cv_.wait(locker, [&]() {
-    // This thread could only continue when context_.queue_ is empty
-    // or the main thread is exiting.
-    return context_.queue_.empty() || context_.isClosing_;
-  });
+  if (!isLastPage && context_.queue_.size() < context_.capacity_) {
+    pool->Submit(owner, std::bind(AsyncFetchOnePage, client, pool, owner,
+                                  std::ref(context_)));
+  } else {
+    // fetching is resumed by the cursor when a slot is freed
+    context_.isFetching_ = false;
+  }
+  context_.cv_.notify_all();
+}
 
-  if (context_.queue_.empty()) {
-    LOG_DEBUG_MSG("Result queue is empty");
-    // context_.queue_ hold one element at most
-    context_.queue_.push(result);
-    context_.cv_.notify_one();
+void DataQuery::StartExecution(ExecuteQueryRequest& request) {
+  control_ = std::make_shared< ExecutionControl >(queryTimeout_);
+
+  // The handler is polled by the HTTP client while the request is in
+  // flight, returning false aborts the request.
+  std::shared_ptr< ExecutionControl > control = control_;
+  request.SetContinueRequestHandler(
+      [control](const Aws::Http::HttpRequest*) {
+        return control->ShouldContinue();
+      });
+}
+
+void DataQuery::AddRequestErrorRecord(const std::string& message) {
+  if (control_->IsTimedOut()) {
+    diag.AddStatusRecord(SqlState::SHYT00_TIMEOUT_EXPIRED,
+                         "Query timeout expired for query " + sql_);
+  } else {
+    diag.AddStatusRecord(SqlState::SHY000_GENERAL_ERROR, message);
   }
 }
 
+void DataQuery::ScheduleFetch() {
+  context_.isFetching_ = true;
+  threadPool_->Submit(&connection_,
+                      std::bind(AsyncFetchOnePage, client_, threadPool_.get(),
+                                &connection_, std::ref(context_)));
+}
+
 SqlResult::Type DataQuery::SwitchCursor() {
   LOG_DEBUG_MSG("SwitchCursor is called");
-  std::unique_lock< std::mutex > locker(context_.mutex_);
-  context_.cv_.wait(locker, [&]() { return !context_.queue_.empty(); });
-  Aws::IoTSiteWise::Model::ExecuteQueryOutcome outcome = context_.queue_.front();
-  context_.queue_.pop();
-  locker.unlock();
-
-  if (!outcome.IsSuccess()) {
-    auto& error = outcome.GetError();
-    LOG_ERROR_MSG("ERROR: " << error.GetExceptionName() << ": "
-                            << error.GetMessage() << ", for query " << sql_
-                            << ", number of rows fetched: " << rowCounter);
-    cursor_.reset();
-    hasAsyncFetch = false;  // no async fetch any more
-    return SqlResult::Type::AI_ERROR;
+  if (!cachedPages_.empty()) {
+    // the cached pages following the first one are not empty
+    result_ = cachedPages_[cachedPage_++];
+    hasAsyncFetch = cachedPage_ < cachedPages_.size();
+    cursor_.reset(new IoTSiteWiseCursor(
+        result_, resultMeta_,
+        connection_.GetConfiguration().GetNestedValuesAsJson()));
+    cursor_->Increment();
+    return SqlResult::AI_SUCCESS;
   }
 
-  result_ = std::make_shared< ExecuteQueryResult >(outcome.GetResult());
-  const Aws::Vector< Row >& rows = outcome.GetResult().GetRows();
-  const Aws::String& token = outcome.GetResult().GetNextToken();
+  if (stream_) {
+    std::string error;
+    if (!stream_->Next(this, control_->GetDeadline(), result_, error)) {
+      LOG_ERROR_MSG("ERROR: " << error << ", for query " << sql_
+                              << ", number of rows fetched: " << rowCounter);
+      return FailCursor();
+    }
+  } else {
+    std::unique_lock< std::mutex > locker(context_.mutex_);
+    context_.cv_.wait(locker, [&]() { return !context_.queue_.empty(); });
+    PageOutcome outcome = std::move(context_.queue_.front());
+    context_.queue_.pop();
+    if (context_.hasMorePages_ && !context_.isFetching_) {
+      // a slot is freed, resume the paused fetching
+      ScheduleFetch();
+    }
+    locker.unlock();
+
+    if (!outcome.IsSuccess()) {
+      auto& error = outcome.GetError();
+      LOG_ERROR_MSG("ERROR: " << error.GetExceptionName() << ": "
+                              << error.GetMessage() << ", for query " << sql_
+                              << ", number of rows fetched: " << rowCounter);
+      return FailCursor();
+    }
+
+    result_ = outcome.GetResult();
+  }
+  const Aws::Vector< Row >& rows = result_->GetRows();
+  const Aws::String& token = result_->GetNextToken();
+  RecordPage(token.empty());
   if (rows.empty()) {
+    hasAsyncFetch = false;  // no async fetch any more
     LOG_INFO_MSG(
         "Data fetching is finished, number of rows fetched: " << rowCounter);
     return SqlResult::AI_NO_DATA;
   }
 
   // switch to rows in next page
-  cursor_.reset(new IoTSiteWiseCursor(rows, resultMeta_));
+  cursor_.reset(new IoTSiteWiseCursor(
+      result_, resultMeta_,
+      connection_.GetConfiguration().GetNestedValuesAsJson()));
   cursor_->Increment();  // The cursor_ needs to be incremented before using it
                          // for the first time
 
@@ -163,33 +364,23 @@ SqlResult::Type DataQuery::SwitchCursor() {
     hasAsyncFetch = false;  // no async fetch any more
     LOG_INFO_MSG(
         "Data fetching is finished, number of rows fetched: " << rowCounter);
-  } else {
-    if (!threads_.empty()) {
-      std::thread& itr = threads_.front();
-      // wait for the last thread to end. The join() should be done before the
-      // thread is popped from the queue. The thread could not be joined after
-      // it is popped from the queue, as it could cause crash.
-      LOG_DEBUG_MSG("Waiting for thread " << itr.get_id() << " to end");
-      if (itr.joinable()) {
-        itr.join();
-      }
-      threads_.pop();
-    } else {
-      LOG_DEBUG_MSG("The threads queue is empty");
-    }
-
-    request_.SetNextToken(token);
-    std::thread next(AsyncFetchOnePage, client_, std::ref(request_),
-                     std::ref(context_));
-    LOG_DEBUG_MSG("New thread " << next.get_id() << " is started");
-    addThreads(next);
   }
 
   return SqlResult::AI_SUCCESS;
 }
 
-SqlResult::Type DataQuery::FetchNextRow(app::ColumnBindingMap& columnBindings) {
-  LOG_DEBUG_MSG("FetchNextRow is called");
+SqlResult::Type DataQuery::FailCursor() {
+  cursor_.reset();
+  hasAsyncFetch = false;  // no async fetch any more
+  StopRecording();
+  if (control_->IsTimedOut()) {
+    diag.AddStatusRecord(SqlState::SHYT00_TIMEOUT_EXPIRED,
+                         "Query timeout expired for query " + sql_);
+  }
+  return SqlResult::Type::AI_ERROR;
+}
+
+SqlResult::Type DataQuery::MoveToNextRow() {
   if (!cursor_) {
     diag.AddStatusRecord(SqlState::S01000_GENERAL_WARNING,
                          "Cursor does not point to any data.",
@@ -197,13 +388,26 @@ SqlResult::Type DataQuery::FetchNextRow(app::ColumnBindingMap& columnBindings) {
     return SqlResult::AI_NO_DATA;
   }
 
+  if (maxRows_ > 0 && static_cast< size_t >(rowCounter) >= maxRows_) {
+    LOG_INFO_MSG("Exit due to max rows " << maxRows_ << " are fetched");
+    if (hasAsyncFetch) {
+      // the pages fetched ahead are not needed, abort the request in flight
+      control_->Cancel();
+      hasAsyncFetch = false;
+    }
+    StopRecording();
+    return SqlResult::AI_NO_DATA;
+  }
+
   if (!cursor_->Increment()) {
     if (hasAsyncFetch) {
       SqlResult::Type result = SwitchCursor();
       if (result != SqlResult::AI_SUCCESS) {
-        diag.AddStatusRecord(SqlState::S24000_INVALID_CURSOR_STATE,
-                             "Invalid cursor state.",
-                             iotsitewise::odbc::LogLevel::Type::WARNING_LEVEL);
+        if (!control_->IsTimedOut()) {
+          diag.AddStatusRecord(
+              SqlState::S24000_INVALID_CURSOR_STATE, "Invalid cursor state.",
+              iotsitewise::odbc::LogLevel::Type::WARNING_LEVEL);
+        }
         return result;
       }
     } else {
@@ -213,6 +417,15 @@ SqlResult::Type DataQuery::FetchNextRow(app::ColumnBindingMap& columnBindings) {
       return SqlResult::AI_NO_DATA;
     }
   }
+  return SqlResult::AI_SUCCESS;
+}
+
+SqlResult::Type DataQuery::FetchNextRow(app::ColumnBindingMap& columnBindings) {
+  LOG_DEBUG_MSG("FetchNextRow is called");
+  SqlResult::Type moved = MoveToNextRow();
+  if (moved != SqlResult::AI_SUCCESS) {
+    return moved;
+  }
 
   for (uint32_t i = 1; i < cursor_->GetColumnSize() + 1; ++i) {
     app::ColumnBindingMap::iterator it = columnBindings.find(i);
@@ -222,7 +435,7 @@ SqlResult::Type DataQuery::FetchNextRow(app::ColumnBindingMap& columnBindings) {
     }
 
     app::ConversionResult::Type convRes =
-        cursor_->ReadColumnToBuffer(i, it->second);
+        cursor_->ReadColumnToBuffer(i, it->second, plan_);
 
     SqlResult::Type result = ProcessConversionResult(convRes, 0, i);
 
@@ -236,6 +449,75 @@ SqlResult::Type DataQuery::FetchNextRow(app::ColumnBindingMap& columnBindings) {
   return SqlResult::AI_SUCCESS;
 }
 
+void DataQuery::FetchNextRows(app::ColumnBindingMap& columnBindings,
+                              SqlUlen rowCount,
+                              std::vector< SqlResult::Type >& rowResults) {
+  LOG_DEBUG_MSG("FetchNextRows is called with rowCount " << rowCount);
+  rowResults.assign(rowCount, SqlResult::AI_NO_DATA);
+
+  // the bindings are looked up once for the rowset instead of once per row
+  boundColumns_.clear();
+  for (app::ColumnBindingMap::iterator it = columnBindings.begin();
+       it != columnBindings.end(); ++it) {
+    if (it->first >= 1 && it->first <= resultMeta_.size()) {
+      BoundColumn bound = {it->first, &it->second};
+      boundColumns_.push_back(bound);
+    }
+  }
+
+  SqlUlen row = 0;
+  while (row < rowCount) {
+    SqlResult::Type moved = MoveToNextRow();
+    if (moved != SqlResult::AI_SUCCESS) {
+      // the following rows are not fetched
+      rowResults[row] = moved;
+      break;
+    }
+
+    // fill the rows of the current page following the cursor
+    size_t count = static_cast< size_t >(
+        std::min< SqlUlen >(rowCount - row, cursor_->GetRowsLeft() + 1));
+    if (maxRows_ > 0) {
+      count = std::min(count, maxRows_ - static_cast< size_t >(rowCounter));
+    }
+    if (convResults_.size() < count) {
+      convResults_.resize(count);
+    }
+
+    std::fill(rowResults.begin() + row, rowResults.begin() + row + count,
+              SqlResult::AI_SUCCESS);
+    for (const BoundColumn& bound : boundColumns_) {
+      cursor_->ReadColumnToBuffers(bound.columnIdx, *bound.buffer, row, count,
+                                   plan_, convResults_.data());
+      for (size_t i = 0; i < count; i++) {
+        if (convResults_[i] == app::ConversionResult::Type::AI_SUCCESS) {
+          continue;
+        }
+        // the diagnostic row numbers start from 1 in the rowset
+        SqlResult::Type result = ProcessConversionResult(
+            convResults_[i], static_cast< int32_t >(row + i + 1),
+            bound.columnIdx);
+        if (result == SqlResult::AI_ERROR) {
+          LOG_ERROR_MSG("Data reading error at row " << row + i);
+          rowResults[row + i] = SqlResult::AI_ERROR;
+        } else if (result == SqlResult::AI_SUCCESS_WITH_INFO
+                   && rowResults[row + i] == SqlResult::AI_SUCCESS) {
+          rowResults[row + i] = SqlResult::AI_SUCCESS_WITH_INFO;
+        }
+      }
+    }
+
+    for (size_t i = 0; i < count; i++) {
+      if (rowResults[row + i] != SqlResult::AI_ERROR) {
+        rowCounter++;
+      }
+    }
+    // the cursor stays on the last row filled
+    cursor_->Advance(count - 1);
+    row += count;
+  }
+}
+
 SqlResult::Type DataQuery::GetColumn(uint16_t columnIdx,
                                      app::ApplicationDataBuffer& buffer) {
   LOG_DEBUG_MSG("GetColumn is called");
@@ -276,21 +558,32 @@ SqlResult::Type DataQuery::Close() {
 SqlResult::Type DataQuery::InternalClose() {
   LOG_DEBUG_MSG("InternalClose is called");
 
-  // stop all asynchronous threads
-  context_.isClosing_ = true;
-  while (!threads_.empty()) {
-    std::thread& itr = threads_.front();
-    // wait for the last thread to end. The join() should be done before the
-    // thread is popped from the queue. The thread could not be joined after
-    // it is popped from the queue, as it could cause crash.
-    if (itr.joinable()) {
-      itr.join();
-    }
-    threads_.pop();
+  // abort the requests in flight, so the running task ends without waiting
+  // for the response
+  control_->Cancel();
+
+  {
+    // stop the asynchronous fetching and wait for the running task to end
+    std::unique_lock< std::mutex > locker(context_.mutex_);
+    context_.isClosing_ = true;
+    context_.cv_.wait(locker, [&]() { return !context_.isFetching_; });
+
+    // reset the context so the query could be executed again
+    std::queue< PageOutcome >().swap(context_.queue_);
+    context_.hasMorePages_ = false;
+    context_.isClosing_ = false;
+  }
+  if (stream_) {
+    stream_->Leave(this);
+    stream_.reset();
   }
+  hasAsyncFetch = false;
+  StopRecording();
+  cachedPages_.clear();
 
   result_.reset();
   cursor_.reset();
+  plan_.Reset();
 
   return SqlResult::AI_SUCCESS;
 }
@@ -328,35 +621,127 @@ SqlResult::Type DataQuery::MakeRequestExecute() {
   LOG_DEBUG_MSG("MakeRequestExecute is called");
 
   LOG_INFO_MSG("sql query: " <<sql_);
+  // start over from the first page on every execution
+  request_ = ExecuteQueryRequest();
   request_.SetQueryStatement(sql_);
+  rowCounter = 0;
+
+  int32_t resultCacheTTL = connection_.GetConfiguration().GetResultCacheTTL();
+  cacheKey_.clear();
+  cachedPages_.clear();
+  StopRecording();
+  if (resultCacheTTL > 0) {
+    // the secrets are compared too, a connection with a wrong secret would
+    // get the results without being authenticated
+    cacheKey_ = QueryResultCache::MakeKey(
+        connection_.GetCredentialsIdentity() + ';'
+            + connection_.GetCredentialsDigest(),
+        sql_);
+    if (QueryResultCache::GetInstance().Get(cacheKey_, resultCacheTTL,
+                                            cachedPages_)) {
+      connection_.AddResultCacheHit();
+      LOG_INFO_MSG("Query result is served from the cache");
+      return MakeRequestExecuteCached();
+    }
+    connection_.AddResultCacheMiss();
+    isRecording_ = true;
+  }
+
   if (connection_.GetConfiguration().IsMaxRowPerPageSet()) {
     LOG_DEBUG_MSG("MaxRowPerPage is set to "
                   << connection_.GetConfiguration().GetMaxRowPerPage());
     request_.SetMaxResults(connection_.GetConfiguration().GetMaxRowPerPage());
   }
+  context_.pageSize_.reset();
+  if (firstPageSize_ > 0) {
+    const config::Configuration& config = connection_.GetConfiguration();
+    // the cursor page and the pages fetched ahead are held at once
+    context_.pageSize_.reset(new AdaptivePageSize(
+        static_cast< int32_t >(std::min< size_t >(firstPageSize_, INT32_MAX)),
+        config.IsMaxRowPerPageSet() ? config.GetMaxRowPerPage() : 0,
+        static_cast< size_t >(config.GetPageMemoryBudget()) * 1024 * 1024,
+        prefetchPages_ + 1));
+    LOG_DEBUG_MSG("Adaptive page sizing starts with "
+                  << context_.pageSize_->GetPageSize() << " rows");
+    request_.SetMaxResults(context_.pageSize_->GetPageSize());
+  }
+  if (maxRows_ > 0) {
+    // do not ask the service for more rows than the application wants
+    CapMaxResults(request_, maxRows_);
+  }
+  if (describeResult_
+      && MillisecondsSince(describeTime_) > DESCRIBE_REUSE_MILLIS) {
+    // a fresh one-row page is reused, the next pages are fetched with the
+    // configured size; a stale one is not, the data may have changed
+    LOG_DEBUG_MSG("Discarding the page of the describe request");
+    describeResult_.reset();
+  }
+  StartExecution(request_);
+
+  if (connection_.GetConfiguration().GetQueryCoalescing() && maxRows_ == 0
+      && firstPageSize_ == 0) {
+    // executions with a row limit or adaptive page sizing request pages
+    // other executions could not reuse
+    bool isNew = false;
+    // a query joining the stream sends no request, so only connections
+    // with the same secrets share it
+    stream_ = SharedQueryStream::Acquire(
+        QueryResultCache::MakeKey(connection_.GetCredentialsIdentity() + ';'
+                                      + connection_.GetCredentialsDigest(),
+                                  sql_),
+        this, isNew);
+    if (!isNew) {
+      LOG_INFO_MSG("Query is coalesced with the identical query in flight");
+      return MakeRequestExecuteShared();
+    }
+  }
 
   do {
-    Aws::IoTSiteWise::Model::ExecuteQueryOutcome outcome =
-        connection_.GetClient()->ExecuteQuery(request_);
- 
-    if (!outcome.IsSuccess()) {
-      auto error = outcome.GetError();
-      LOG_ERROR_MSG("ERROR: " << error.GetExceptionName() << ": "
-                              << error.GetMessage() << " for query " << sql_);
- 
-      diag.AddStatusRecord(
-          SqlState::SHY000_GENERAL_ERROR,
-          "AWS API Failure: Failed to execute query \"" + sql_ + "\"");
-      InternalClose();
-      return SqlResult::AI_ERROR;
+    if (describeResult_) {
+      // reuse the first page fetched by the describe request
+      LOG_DEBUG_MSG("Reusing the page of the describe request");
+      result_ = std::move(describeResult_);
+    } else {
+      std::chrono::steady_clock::time_point start =
+          std::chrono::steady_clock::now();
+      PageOutcome outcome =
+          connection_.GetClient()->ExecuteQueryPage(request_);
+      int64_t latency = MillisecondsSince(start);
+
+      if (!outcome.IsSuccess()) {
+        auto error = outcome.GetError();
+        LOG_ERROR_MSG("ERROR: " << error.GetExceptionName() << ": "
+                                << error.GetMessage() << " for query "
+                                << sql_);
+
+        std::string message =
+            "AWS API Failure: Failed to execute query \"" + sql_ + "\"";
+        if (stream_) {
+          stream_->Fail(message);
+        }
+        AddRequestErrorRecord(message);
+        InternalClose();
+        return SqlResult::AI_ERROR;
+      }
+
+      // outcome is successful, update result_
+      result_ = outcome.GetResultWithOwnership();
+      if (context_.pageSize_) {
+        context_.pageSize_->Update(result_->GetRows().size(),
+                                   EstimatePageBytes(*result_), latency);
+        request_.SetMaxResults(context_.pageSize_->GetPageSize());
+      }
     }
- 
-    // outcome is successful, update result_
-    result_ = std::make_shared< ExecuteQueryResult >(outcome.GetResult());
+
     if (result_->GetRows().empty()) {
       if (result_->GetNextToken().empty()) {
         // result is empty
         LOG_DEBUG_MSG("QueryResult is empty, returning no data");
+        RecordPage(true);
+        if (stream_) {
+          stream_->Start(this, client_, threadPool_.get(), request_, result_,
+                         prefetchPages_);
+        }
         return SqlResult::AI_NO_DATA;
       }
       request_.SetNextToken(result_->GetNextToken());
@@ -366,15 +751,34 @@ SqlResult::Type DataQuery::MakeRequestExecute() {
     }
   } while (true);
  
-  cursor_.reset(new IoTSiteWiseCursor(result_->GetRows(), resultMeta_));
- 
-  if (!result_->GetNextToken().empty()) {
-    LOG_DEBUG_MSG(
-        "Next token is not empty, starting async thread to fetch next page");
+  RecordPage(result_->GetNextToken().empty());
+  size_t rowsFetched = result_->GetRows().size();
+  if (stream_) {
+    // the following pages are fetched once for all identical queries
+    stream_->Start(this, client_, threadPool_.get(), request_, result_,
+                   prefetchPages_);
+    hasAsyncFetch = !result_->GetNextToken().empty();
+  } else if (maxRows_ > 0 && rowsFetched >= maxRows_) {
+    LOG_DEBUG_MSG("Row limit " << maxRows_
+                               << " is reached by the first page");
+    if (!result_->GetNextToken().empty()) {
+      StopRecording();
+    }
+  } else if (!result_->GetNextToken().empty()) {
+    LOG_DEBUG_MSG("Next token is not empty, starting async fetch of up to "
+                  << prefetchPages_ << " pages ahead");
     request_.SetNextToken(result_->GetNextToken());
-    std::thread next(AsyncFetchOnePage, client_, std::ref(request_),
-                     std::ref(context_));
-    addThreads(next);
+    if (maxRows_ > 0) {
+      CapMaxResults(request_, maxRows_ - rowsFetched);
+    }
+
+    std::lock_guard< std::mutex > locker(context_.mutex_);
+    context_.capacity_ = prefetchPages_;
+    context_.request_ = request_;
+    context_.hasMorePages_ = true;
+    context_.rowLimit_ = maxRows_;
+    context_.rowsFetched_ = rowsFetched;
+    ScheduleFetch();
     hasAsyncFetch = true;
   }
  
@@ -382,6 +786,78 @@ SqlResult::Type DataQuery::MakeRequestExecute() {
   return retval;
 }
 
+SqlResult::Type DataQuery::MakeRequestExecuteCached() {
+  LOG_DEBUG_MSG("MakeRequestExecuteCached is called");
+  // the page kept by a describe request is not needed
+  describeResult_.reset();
+
+  result_ = cachedPages_.front();
+  cachedPage_ = 1;
+  if (result_->GetRows().empty()) {
+    LOG_DEBUG_MSG("QueryResult is empty, returning no data");
+    return SqlResult::AI_NO_DATA;
+  }
+
+  hasAsyncFetch = cachedPage_ < cachedPages_.size();
+  return MakeRequestFetch();
+}
+
+SqlResult::Type DataQuery::MakeRequestExecuteShared() {
+  LOG_DEBUG_MSG("MakeRequestExecuteShared is called");
+  // the page kept by a describe request is not needed
+  describeResult_.reset();
+
+  std::string error;
+  if (!stream_->Next(this, control_->GetDeadline(), result_, error)) {
+    LOG_ERROR_MSG("ERROR: " << error << " for query " << sql_);
+    AddRequestErrorRecord(error);
+    InternalClose();
+    return SqlResult::AI_ERROR;
+  }
+
+  RecordPage(result_->GetNextToken().empty());
+  if (result_->GetRows().empty()) {
+    LOG_DEBUG_MSG("QueryResult is empty, returning no data");
+    return SqlResult::AI_NO_DATA;
+  }
+
+  hasAsyncFetch = !result_->GetNextToken().empty();
+  return MakeRequestFetch();
+}
+
+void DataQuery::RecordPage(bool isLast) {
+  if (!isRecording_) {
+    return;
+  }
+
+  // keep the empty page only when the whole result is empty
+  if (!result_->GetRows().empty() || (isLast && recordedPages_.empty())) {
+    recordedBytes_ += sizeof(DecodedPage) + EstimatePageBytes(*result_);
+    recordedPages_.push_back(result_);
+  }
+
+  size_t capacity = static_cast< size_t >(
+                        connection_.GetConfiguration().GetResultCacheSize())
+                    * 1024 * 1024;
+  if (recordedBytes_ > capacity) {
+    LOG_DEBUG_MSG("Query result is too large to be cached");
+    StopRecording();
+    return;
+  }
+
+  if (isLast) {
+    QueryResultCache::GetInstance().Put(cacheKey_, recordedPages_,
+                                        recordedBytes_, capacity);
+    StopRecording();
+  }
+}
+
+void DataQuery::StopRecording() {
+  isRecording_ = false;
+  recordedPages_.clear();
+  recordedBytes_ = 0;
+}
+
 SqlResult::Type DataQuery::MakeRequestFetch() {
   LOG_DEBUG_MSG("MakeRequestFetch is called");
 
@@ -403,7 +879,9 @@ SqlResult::Type DataQuery::MakeRequestFetch() {
     retval = SqlResult::AI_NO_DATA;
   } else {
     LOG_DEBUG_MSG("Result has " << result_->GetRows().size() << " rows");
-    cursor_.reset(new IoTSiteWiseCursor(result_->GetRows(), resultMeta_));
+    cursor_.reset(new IoTSiteWiseCursor(
+        result_, resultMeta_,
+        connection_.GetConfiguration().GetNestedValuesAsJson()));
   }
 
   LOG_DEBUG_MSG("retval is " << retval);
@@ -414,25 +892,28 @@ SqlResult::Type DataQuery::MakeRequestFetch() {
 SqlResult::Type DataQuery::MakeRequestResultsetMeta() {
   LOG_DEBUG_MSG("MakeRequestResultsetMeta is called");
 
+  // Only the column information is needed, so fetch the smallest page.
+  // The page is kept for the execution following the describe.
   ExecuteQueryRequest request;
   request.SetQueryStatement(sql_);
+  request.SetMaxResults(DESCRIBE_PAGE_SIZE);
+  StartExecution(request);
 
-  Aws::IoTSiteWise::Model::ExecuteQueryOutcome outcome =
-      connection_.GetClient()->ExecuteQuery(request);
+  PageOutcome outcome = connection_.GetClient()->ExecuteQueryPage(request);
  
   if (!outcome.IsSuccess()) {
     auto const error = outcome.GetError();
  
-    diag.AddStatusRecord(SqlState::SHY000_GENERAL_ERROR,
-                         "AWS API ERROR: " + error.GetExceptionName() + ": "
-                             + error.GetMessage() + " for query " + sql_);
+    AddRequestErrorRecord("AWS API ERROR: " + error.GetExceptionName() + ": "
+                          + error.GetMessage() + " for query " + sql_);
  
     InternalClose();
     return SqlResult::AI_ERROR;
   }
   // outcome is successful
-  ExecuteQueryResult result = outcome.GetResult();
-  const Aws::Vector< ColumnInfo >& columnInfo = result.GetColumns();
+  describeResult_ = outcome.GetResultWithOwnership();
+  describeTime_ = std::chrono::steady_clock::now();
+  const Aws::Vector< ColumnInfo >& columnInfo = describeResult_->GetColumns();
  
   ReadColumnMetadataVector(columnInfo);
  
@@ -452,11 +933,12 @@ void DataQuery::ReadColumnMetadataVector(
     return;
   }
 
-  for (ColumnInfo swMetadata : swVector) {
+  for (const ColumnInfo& swMetadata : swVector) {
     resultMeta_.emplace_back(ColumnMeta());
     resultMeta_.back().ReadMetadata(swMetadata);
   }
   resultMetaAvailable_ = true;
+  connection_.GetMetaCache().Put(sql_, resultMeta_);
 }
 
 SqlResult::Type DataQuery::ProcessConversionResult(
@@ -0,0 +1,121 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "iotsitewise/odbc/query_client.h"
+
+#include <iterator>
+#include <string>
+
+#include <aws/core/AmazonWebServiceResult.h>
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/iotsitewise/model/ExecuteQueryResult.h>
+
+#include "iotsitewise/odbc/log.h"
+#include "iotsitewise/odbc/response_decoder.h"
+
+using Aws::IoTSiteWise::IoTSiteWiseError;
+using Aws::IoTSiteWise::Model::ExecuteQueryOutcome;
+using Aws::IoTSiteWise::Model::ExecuteQueryRequest;
+using Aws::IoTSiteWise::Model::ExecuteQueryResult;
+
+namespace iotsitewise {
+namespace odbc {
+QueryClient::QueryClient(
+    const Aws::Auth::AWSCredentials& credentials,
+    const Aws::Client::ClientConfiguration& clientConfiguration,
+    bool rawResponseDecoding)
+    : Aws::IoTSiteWise::IoTSiteWiseClient(credentials, clientConfiguration),
+      rawResponseDecoding_(rawResponseDecoding) {
+  // No-op.
+}
+
+QueryClient::QueryClient(
+    const std::shared_ptr< Aws::Auth::AWSCredentialsProvider >&
+        credentialsProvider,
+    const Aws::Client::ClientConfiguration& clientConfiguration,
+    bool rawResponseDecoding)
+    : Aws::IoTSiteWise::IoTSiteWiseClient(credentialsProvider,
+                                          clientConfiguration),
+      rawResponseDecoding_(rawResponseDecoding) {
+  // No-op.
+}
+
+PageOutcome QueryClient::ExecuteQueryPage(
+    const ExecuteQueryRequest& request) {
+  if (rawResponseDecoding_) {
+    return ExecuteQueryRaw(request);
+  }
+
+  ExecuteQueryOutcome outcome = ExecuteQuery(request);
+  if (!outcome.IsSuccess()) {
+    return PageOutcome(outcome.GetError());
+  }
+  return PageOutcome(std::shared_ptr< const DecodedPage >(
+      std::make_shared< DecodedPage >(outcome.GetResultWithOwnership())));
+}
+
+PageOutcome QueryClient::ExecuteQueryRaw(const ExecuteQueryRequest& request) {
+  LOG_DEBUG_MSG("ExecuteQueryRaw is called");
+  // the endpoint is resolved as ExecuteQuery does
+  Aws::Endpoint::ResolveEndpointOutcome endpoint =
+      accessEndpointProvider()->ResolveEndpoint(
+          request.GetEndpointContextParams());
+  if (!endpoint.IsSuccess()) {
+    return PageOutcome(IoTSiteWiseError(endpoint.GetError()));
+  }
+  endpoint.GetResult().AddPrefixIfMissing("data.");
+  endpoint.GetResult().AddPathSegments("/queries/execution");
+
+  Aws::Client::StreamOutcome response = MakeRequestWithUnparsedResponse(
+      request, endpoint.GetResult(), Aws::Http::HttpMethod::HTTP_POST,
+      Aws::Auth::SIGV4_SIGNER);
+  if (!response.IsSuccess()) {
+    return PageOutcome(IoTSiteWiseError(response.GetError()));
+  }
+
+  Aws::AmazonWebServiceResult< Aws::Utils::Stream::ResponseStream > result =
+      response.GetResultWithOwnership();
+  Aws::IOStream& stream = result.GetPayload().GetUnderlyingStream();
+  std::string body((std::istreambuf_iterator< char >(stream)),
+                   std::istreambuf_iterator< char >());
+
+  std::shared_ptr< DecodedPage > page =
+      ResponseDecoder::Decode(body.data(), body.size());
+  if (page) {
+    return PageOutcome(std::shared_ptr< const DecodedPage >(std::move(page)));
+  }
+
+  // fall back to the SDK model for the content the decoder does not handle
+  Aws::Utils::Json::JsonValue json(Aws::String(body.data(), body.size()));
+  if (!json.WasParseSuccessful()) {
+    LOG_ERROR_MSG("Failed to parse the response: " << json.GetErrorMessage());
+    return PageOutcome(IoTSiteWiseError(
+        Aws::Client::AWSError< Aws::Client::CoreErrors >(
+            Aws::Client::CoreErrors::UNKNOWN, "Json Parser",
+            json.GetErrorMessage(), false)));
+  }
+  ExecuteQueryResult model(Aws::AmazonWebServiceResult<
+                           Aws::Utils::Json::JsonValue >(
+      json, result.GetHeaderValueCollection(), result.GetResponseCode()));
+  return PageOutcome(std::shared_ptr< const DecodedPage >(
+      std::make_shared< DecodedPage >(std::move(model))));
+}
+}  // namespace odbc
+}  // namespace iotsitewise
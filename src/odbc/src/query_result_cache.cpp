@@ -0,0 +1,115 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "iotsitewise/odbc/query_result_cache.h"
+
+#include <iterator>
+
+#include "iotsitewise/odbc/log.h"
+#include "iotsitewise/odbc/meta/result_set_meta_cache.h"
+
+namespace iotsitewise {
+namespace odbc {
+QueryResultCache::QueryResultCache() : bytes_(0) {
+  // No-op.
+}
+
+QueryResultCache& QueryResultCache::GetInstance() {
+  // kept across connections, as refreshing applications often reconnect
+  static QueryResultCache instance;
+  return instance;
+}
+
+std::string QueryResultCache::MakeKey(const std::string& identity,
+                                      const std::string& sql) {
+  return identity + '\n' + meta::ResultSetMetaCache::Normalize(sql);
+}
+
+bool QueryResultCache::Get(const std::string& key, int32_t ttl,
+                           Pages& pages) {
+  std::lock_guard< std::mutex > lock(mutex_);
+  std::unordered_map< std::string, EntryList::iterator >::iterator it =
+      index_.find(key);
+  if (it == index_.end()) {
+    return false;
+  }
+
+  if (Clock::now() >= it->second->created + std::chrono::seconds(ttl)) {
+    LOG_DEBUG_MSG("Cached query result is expired");
+    Erase(it->second);
+    return false;
+  }
+
+  // move the entry to the front as the most recently used one
+  entries_.splice(entries_.begin(), entries_, it->second);
+  pages = it->second->pages;
+  return true;
+}
+
+void QueryResultCache::Put(const std::string& key, const Pages& pages,
+                           size_t bytes, size_t capacity) {
+  std::lock_guard< std::mutex > lock(mutex_);
+  std::unordered_map< std::string, EntryList::iterator >::iterator it =
+      index_.find(key);
+  if (it != index_.end()) {
+    Erase(it->second);
+  }
+
+  if (bytes > capacity) {
+    LOG_DEBUG_MSG("Query result of " << bytes
+                                     << " bytes is too large to be cached");
+    return;
+  }
+
+  while (!entries_.empty() && bytes_ + bytes > capacity) {
+    // evict the least recently used entry
+    Erase(std::prev(entries_.end()));
+  }
+
+  Entry entry;
+  entry.key = key;
+  entry.created = Clock::now();
+  entry.bytes = bytes;
+  entry.pages = pages;
+  entries_.push_front(std::move(entry));
+  index_[key] = entries_.begin();
+  bytes_ += bytes;
+}
+
+void QueryResultCache::Clear() {
+  std::lock_guard< std::mutex > lock(mutex_);
+  entries_.clear();
+  index_.clear();
+  bytes_ = 0;
+}
+
+size_t QueryResultCache::GetSize() const {
+  std::lock_guard< std::mutex > lock(mutex_);
+  return entries_.size();
+}
+
+size_t QueryResultCache::GetBytes() const {
+  std::lock_guard< std::mutex > lock(mutex_);
+  return bytes_;
+}
+
+void QueryResultCache::Erase(EntryList::iterator it) {
+  bytes_ -= it->bytes;
+  index_.erase(it->key);
+  entries_.erase(it);
+}
+}  // namespace odbc
+}  // namespace iotsitewise
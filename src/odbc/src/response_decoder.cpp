@@ -0,0 +1,831 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "iotsitewise/odbc/response_decoder.h"
+
+#include <ctype.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include <aws/iotsitewise/model/ColumnInfo.h>
+#include <aws/iotsitewise/model/ColumnType.h>
+#include <aws/iotsitewise/model/Datum.h>
+#include <aws/iotsitewise/model/ExecuteQueryResult.h>
+#include <aws/iotsitewise/model/Row.h>
+#include <aws/iotsitewise/model/ScalarType.h>
+
+#include "iotsitewise/odbc/log.h"
+
+using Aws::IoTSiteWise::Model::ColumnInfo;
+using Aws::IoTSiteWise::Model::ColumnType;
+using Aws::IoTSiteWise::Model::Datum;
+using Aws::IoTSiteWise::Model::ExecuteQueryResult;
+using Aws::IoTSiteWise::Model::Row;
+using Aws::IoTSiteWise::Model::ScalarType;
+
+namespace iotsitewise {
+namespace odbc {
+namespace {
+/** Max nesting depth of array and row values. */
+const int MAX_DEPTH = 64;
+
+/** Key of an object member. */
+struct JsonKey {
+  /** Key text. */
+  const char* str;
+
+  /** Length of the key text. */
+  size_t len;
+
+  /**
+   * Check the key.
+   *
+   * @param name Expected key.
+   * @return True if the key is the expected one.
+   */
+  template < size_t N >
+  bool Is(const char (&name)[N]) const {
+    return len == N - 1 && memcmp(str, name, N - 1) == 0;
+  }
+};
+
+/**
+ * Reader of a JSON text in memory. The strings without escape sequences are
+ * pointed to in the text instead of being copied.
+ */
+class JsonReader {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param begin Beginning of the text.
+   * @param end End of the text.
+   */
+  JsonReader(const char* begin, const char* end) : pos_(begin), end_(end) {
+    // No-op.
+  }
+
+  /**
+   * Consume the next character if it is the expected one.
+   *
+   * @param c Expected character.
+   * @return True if the character is consumed.
+   */
+  bool Consume(char c) {
+    SkipWhitespace();
+    if (pos_ != end_ && *pos_ == c) {
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+
+  /**
+   * Check if the whole text is read.
+   *
+   * @return True if only whitespace is left.
+   */
+  bool AtEnd() {
+    SkipWhitespace();
+    return pos_ == end_;
+  }
+
+  /**
+   * Consume a null literal if it is next.
+   *
+   * @return True if a null is consumed.
+   */
+  bool ReadNull() {
+    return ReadLiteral("null", 4);
+  }
+
+  /**
+   * Read a boolean.
+   *
+   * @param value Value read.
+   * @return True on success.
+   */
+  bool ReadBool(bool& value) {
+    value = ReadLiteral("true", 4);
+    return value || ReadLiteral("false", 5);
+  }
+
+  /**
+   * Read a string.
+   *
+   * @param str Text of the string. It points to the JSON text, or to the
+   *     buffer if the string has escape sequences.
+   * @param len Length of the text.
+   * @param buffer Buffer for the unescaped text.
+   * @return True on success.
+   */
+  bool ReadString(const char*& str, size_t& len, std::string& buffer) {
+    if (!Consume('"')) {
+      return false;
+    }
+
+    const char* begin = pos_;
+    const char* quote =
+        static_cast< const char* >(memchr(pos_, '"', end_ - pos_));
+    if (!quote) {
+      return false;
+    }
+    const char* escape =
+        static_cast< const char* >(memchr(pos_, '\\', quote - pos_));
+    if (!escape) {
+      str = begin;
+      len = quote - begin;
+      pos_ = quote + 1;
+      return true;
+    }
+
+    buffer.assign(begin, escape);
+    pos_ = escape;
+    while (pos_ != end_) {
+      char c = *pos_++;
+      if (c == '"') {
+        str = buffer.data();
+        len = buffer.size();
+        return true;
+      }
+      if (c != '\\') {
+        buffer.push_back(c);
+      } else if (!ReadEscape(buffer)) {
+        return false;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Read a string.
+   *
+   * @param value Value read.
+   * @return True on success.
+   */
+  bool ReadString(Aws::String& value) {
+    const char* str = nullptr;
+    size_t len = 0;
+    if (!ReadString(str, len, buffer_)) {
+      return false;
+    }
+    value.assign(str, len);
+    return true;
+  }
+
+  /**
+   * Read an object.
+   *
+   * @param handler Called for each member with its key, it must read the
+   *     value of the member. The key is only valid until the value is read.
+   * @return True on success.
+   */
+  template < typename Handler >
+  bool ReadObject(Handler handler) {
+    if (!Consume('{')) {
+      return false;
+    }
+    if (Consume('}')) {
+      return true;
+    }
+
+    do {
+      JsonKey key;
+      if (!ReadString(key.str, key.len, keyBuffer_) || !Consume(':')
+          || !handler(key)) {
+        return false;
+      }
+    } while (Consume(','));
+    return Consume('}');
+  }
+
+  /**
+   * Read an array.
+   *
+   * @param handler Called for each element, it must read the element.
+   * @return True on success.
+   */
+  template < typename Handler >
+  bool ReadArray(Handler handler) {
+    if (!Consume('[')) {
+      return false;
+    }
+    if (Consume(']')) {
+      return true;
+    }
+
+    do {
+      if (!handler()) {
+        return false;
+      }
+    } while (Consume(','));
+    return Consume(']');
+  }
+
+  /**
+   * Skip a value.
+   *
+   * @param depth Nesting depth of the value.
+   * @return True on success.
+   */
+  bool SkipValue(int depth) {
+    if (depth > MAX_DEPTH) {
+      return false;
+    }
+
+    SkipWhitespace();
+    if (pos_ == end_) {
+      return false;
+    }
+    switch (*pos_) {
+      case '{':
+        return ReadObject(
+            [this, depth](const JsonKey&) { return SkipValue(depth + 1); });
+      case '[':
+        return ReadArray([this, depth]() { return SkipValue(depth + 1); });
+      case '"': {
+        const char* str = nullptr;
+        size_t len = 0;
+        return ReadString(str, len, buffer_);
+      }
+      default: {
+        // number or literal
+        const char* begin = pos_;
+        while (pos_ != end_
+               && (isalnum(static_cast< unsigned char >(*pos_)) || *pos_ == '-'
+                   || *pos_ == '+' || *pos_ == '.')) {
+          ++pos_;
+        }
+        return pos_ != begin;
+      }
+    }
+  }
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(JsonReader);
+
+  /** Skip whitespace. */
+  void SkipWhitespace() {
+    while (pos_ != end_
+           && (*pos_ == ' ' || *pos_ == '\n' || *pos_ == '\r'
+               || *pos_ == '\t')) {
+      ++pos_;
+    }
+  }
+
+  /**
+   * Consume a literal if it is next.
+   *
+   * @param literal Literal.
+   * @param len Length of the literal.
+   * @return True if the literal is consumed.
+   */
+  bool ReadLiteral(const char* literal, size_t len) {
+    SkipWhitespace();
+    if (static_cast< size_t >(end_ - pos_) < len
+        || memcmp(pos_, literal, len) != 0) {
+      return false;
+    }
+    pos_ += len;
+    return true;
+  }
+
+  /**
+   * Read four hexadecimal digits.
+   *
+   * @param value Value read.
+   * @return True on success.
+   */
+  bool ReadHex4(uint32_t& value) {
+    if (end_ - pos_ < 4) {
+      return false;
+    }
+    value = 0;
+    for (int i = 0; i < 4; i++) {
+      char c = *pos_++;
+      uint32_t digit;
+      if (c >= '0' && c <= '9') {
+        digit = c - '0';
+      } else if (c >= 'a' && c <= 'f') {
+        digit = c - 'a' + 10;
+      } else if (c >= 'A' && c <= 'F') {
+        digit = c - 'A' + 10;
+      } else {
+        return false;
+      }
+      value = (value << 4) | digit;
+    }
+    return true;
+  }
+
+  /**
+   * Read an escape sequence following a backslash and append the character
+   * to the buffer, encoded in UTF-8.
+   *
+   * @param buffer Buffer.
+   * @return True on success.
+   */
+  bool ReadEscape(std::string& buffer) {
+    if (pos_ == end_) {
+      return false;
+    }
+
+    char c = *pos_++;
+    switch (c) {
+      case '"':
+      case '\\':
+      case '/':
+        buffer.push_back(c);
+        return true;
+      case 'b':
+        buffer.push_back('\b');
+        return true;
+      case 'f':
+        buffer.push_back('\f');
+        return true;
+      case 'n':
+        buffer.push_back('\n');
+        return true;
+      case 'r':
+        buffer.push_back('\r');
+        return true;
+      case 't':
+        buffer.push_back('\t');
+        return true;
+      case 'u':
+        break;
+      default:
+        return false;
+    }
+
+    uint32_t cp = 0;
+    if (!ReadHex4(cp) || (cp >= 0xDC00 && cp <= 0xDFFF)) {
+      return false;
+    }
+    if (cp >= 0xD800 && cp <= 0xDBFF) {
+      // high surrogate, the low surrogate must follow
+      uint32_t low = 0;
+      if (end_ - pos_ < 2 || pos_[0] != '\\' || pos_[1] != 'u') {
+        return false;
+      }
+      pos_ += 2;
+      if (!ReadHex4(low) || low < 0xDC00 || low > 0xDFFF) {
+        return false;
+      }
+      cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+    }
+
+    if (cp < 0x80) {
+      buffer.push_back(static_cast< char >(cp));
+    } else if (cp < 0x800) {
+      buffer.push_back(static_cast< char >(0xC0 | (cp >> 6)));
+      buffer.push_back(static_cast< char >(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+      buffer.push_back(static_cast< char >(0xE0 | (cp >> 12)));
+      buffer.push_back(static_cast< char >(0x80 | ((cp >> 6) & 0x3F)));
+      buffer.push_back(static_cast< char >(0x80 | (cp & 0x3F)));
+    } else {
+      buffer.push_back(static_cast< char >(0xF0 | (cp >> 18)));
+      buffer.push_back(static_cast< char >(0x80 | ((cp >> 12) & 0x3F)));
+      buffer.push_back(static_cast< char >(0x80 | ((cp >> 6) & 0x3F)));
+      buffer.push_back(static_cast< char >(0x80 | (cp & 0x3F)));
+    }
+    return true;
+  }
+
+  /** Current position. */
+  const char* pos_;
+
+  /** End of the text. */
+  const char* end_;
+
+  /** Buffer for unescaped keys. */
+  std::string keyBuffer_;
+
+  /** Buffer for unescaped strings. */
+  std::string buffer_;
+};
+
+/**
+ * Reader of an ExecuteQuery response into a decoded page.
+ */
+class PageReader {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param body Response body.
+   * @param size Size of the body in bytes.
+   */
+  PageReader(const char* body, size_t size)
+      : reader_(body, body + size),
+        hasColumns_(false),
+        hasRows_(false),
+        hasNextToken_(false),
+        minValues_(0),
+        keptValues_(0) {
+    // No-op.
+  }
+
+  /**
+   * Read the response.
+   *
+   * @return Page, or nullptr if the response is not decoded.
+   */
+  std::shared_ptr< DecodedPage > Read() {
+    bool isRead = reader_.ReadObject([this](const JsonKey& key) {
+      if (key.Is("columns")) {
+        return !hasColumns_ && ReadColumns();
+      }
+      if (key.Is("rows")) {
+        // the values are decoded by the types of the columns
+        return hasColumns_ && !hasRows_ && ReadRows();
+      }
+      if (key.Is("nextToken")) {
+        if (reader_.ReadNull()) {
+          return true;
+        }
+        hasNextToken_ = true;
+        return reader_.ReadString(nextToken_);
+      }
+      return reader_.SkipValue(0);
+    });
+    if (!isRead || !reader_.AtEnd()) {
+      return nullptr;
+    }
+
+    ExecuteQueryResult result;
+    if (hasColumns_) {
+      result.SetColumns(std::move(columnInfo_));
+    }
+    if (hasRows_) {
+      result.SetRows(std::move(rows_));
+    }
+    if (hasNextToken_) {
+      result.SetNextToken(std::move(nextToken_));
+    }
+    return std::make_shared< DecodedPage >(std::move(result),
+                                           std::move(columns_));
+  }
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(PageReader);
+
+  /**
+   * Read the columns and choose the columns to decode.
+   *
+   * @return True on success.
+   */
+  bool ReadColumns() {
+    hasColumns_ = true;
+    if (reader_.ReadNull()) {
+      return true;
+    }
+
+    bool isRead = reader_.ReadArray([this]() {
+      ColumnInfo info;
+      if (!ReadColumnInfo(info)) {
+        return false;
+      }
+      columnInfo_.push_back(std::move(info));
+      return true;
+    });
+    if (!isRead) {
+      return false;
+    }
+
+    columns_.resize(columnInfo_.size());
+    for (size_t i = 0; i < columnInfo_.size(); i++) {
+      const ColumnType& type = columnInfo_[i].GetType();
+      DecodedPage::Column& column = columns_[i];
+      if (type.ScalarTypeHasBeenSet()) {
+        column.type = type.GetScalarType();
+      }
+      switch (column.type) {
+        case ScalarType::DOUBLE:
+        case ScalarType::INT:
+        case ScalarType::BOOLEAN:
+        case ScalarType::TIMESTAMP:
+          column.isDecoded = true;
+          minValues_ = i + 1;
+          break;
+        default:
+          keptValues_ = i + 1;
+          break;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Read a column.
+   *
+   * @param info Column read.
+   * @return True on success.
+   */
+  bool ReadColumnInfo(ColumnInfo& info) {
+    return reader_.ReadObject([this, &info](const JsonKey& key) {
+      if (reader_.ReadNull()) {
+        return true;
+      }
+      if (key.Is("name")) {
+        Aws::String name;
+        if (!reader_.ReadString(name)) {
+          return false;
+        }
+        info.SetName(std::move(name));
+        return true;
+      }
+      if (key.Is("type")) {
+        ColumnType type;
+        if (!ReadColumnType(type)) {
+          return false;
+        }
+        info.SetType(std::move(type));
+        return true;
+      }
+      return reader_.SkipValue(1);
+    });
+  }
+
+  /**
+   * Read a column type.
+   *
+   * @param type Column type read.
+   * @return True on success.
+   */
+  bool ReadColumnType(ColumnType& type) {
+    return reader_.ReadObject([this, &type](const JsonKey& key) {
+      if (reader_.ReadNull()) {
+        return true;
+      }
+      if (key.Is("scalarType")) {
+        Aws::String name;
+        if (!reader_.ReadString(name)) {
+          return false;
+        }
+        type.SetScalarType(
+            Aws::IoTSiteWise::Model::ScalarTypeMapper::GetScalarTypeForName(
+                name));
+        return true;
+      }
+      return reader_.SkipValue(2);
+    });
+  }
+
+  /**
+   * Read the rows.
+   *
+   * @return True on success.
+   */
+  bool ReadRows() {
+    hasRows_ = true;
+    if (reader_.ReadNull()) {
+      return true;
+    }
+
+    return reader_.ReadArray([this]() {
+      Row row;
+      if (!ReadRow(row)) {
+        return false;
+      }
+      rows_.push_back(std::move(row));
+      return true;
+    });
+  }
+
+  /**
+   * Read a row of the page. The values of the decoded columns are appended
+   * to the columns, the row only keeps the other values.
+   *
+   * @param row Row read.
+   * @return True on success.
+   */
+  bool ReadRow(Row& row) {
+    size_t valueCount = 0;
+    bool isRead = reader_.ReadObject([this, &row, &valueCount](
+                                         const JsonKey& key) {
+      if (!key.Is("data")) {
+        return reader_.SkipValue(1);
+      }
+      if (reader_.ReadNull()) {
+        return true;
+      }
+
+      Aws::Vector< Datum > data;
+      data.reserve(keptValues_);
+      bool isDataRead = reader_.ReadArray([this, &data, &valueCount]() {
+        size_t idx = valueCount++;
+        if (idx < columns_.size() && columns_[idx].isDecoded) {
+          if (idx < keptValues_) {
+            data.push_back(Datum());
+          }
+          return ReadDecodedValue(columns_[idx]);
+        }
+        if (idx >= keptValues_) {
+          // the value could not be read by the cursor
+          return reader_.SkipValue(2);
+        }
+        Datum datum;
+        if (!ReadDatum(datum, 2)) {
+          return false;
+        }
+        data.push_back(std::move(datum));
+        return true;
+      });
+      row.SetData(std::move(data));
+      return isDataRead;
+    });
+    // every decoded column must have a value in the row
+    return isRead && valueCount >= minValues_;
+  }
+
+  /**
+   * Read a value of a decoded column and append it to the column.
+   *
+   * @param column Column.
+   * @return True if the value is decoded.
+   */
+  bool ReadDecodedValue(DecodedPage::Column& column) {
+    bool hasValue = false;
+    bool hasNull = false;
+    bool isRead = reader_.ReadObject([this, &column, &hasValue, &hasNull](
+                                         const JsonKey& key) {
+      if (reader_.ReadNull()) {
+        return true;
+      }
+      if (key.Is("scalarValue")) {
+        const char* str = nullptr;
+        size_t len = 0;
+        if (hasValue || !reader_.ReadString(str, len, buffer_)) {
+          return false;
+        }
+        hasValue = true;
+        return DecodedPage::AppendValue(column, str, len);
+      }
+      if (key.Is("nullValue")) {
+        bool isNull = false;
+        hasNull = true;
+        return reader_.ReadBool(isNull);
+      }
+      // an array or row value is formatted as text by the column
+      return !key.Is("arrayValue") && !key.Is("rowValue")
+             && reader_.SkipValue(3);
+    });
+    if (!isRead) {
+      return false;
+    }
+    if (!hasValue) {
+      return hasNull && DecodedPage::AppendValue(column, nullptr, 0);
+    }
+    return true;
+  }
+
+  /**
+   * Read a value of a column that is not decoded.
+   *
+   * @param datum Value read.
+   * @param depth Nesting depth of the value.
+   * @return True on success.
+   */
+  bool ReadDatum(Datum& datum, int depth) {
+    if (depth > MAX_DEPTH) {
+      return false;
+    }
+
+    return reader_.ReadObject([this, &datum, depth](const JsonKey& key) {
+      if (reader_.ReadNull()) {
+        return true;
+      }
+      if (key.Is("scalarValue")) {
+        Aws::String value;
+        if (!reader_.ReadString(value)) {
+          return false;
+        }
+        datum.SetScalarValue(std::move(value));
+        return true;
+      }
+      if (key.Is("arrayValue")) {
+        Aws::Vector< Datum > values;
+        bool isRead = reader_.ReadArray([this, &values, depth]() {
+          Datum value;
+          if (!ReadDatum(value, depth + 1)) {
+            return false;
+          }
+          values.push_back(std::move(value));
+          return true;
+        });
+        datum.SetArrayValue(std::move(values));
+        return isRead;
+      }
+      if (key.Is("rowValue")) {
+        Row row;
+        if (!ReadNestedRow(row, depth + 1)) {
+          return false;
+        }
+        datum.SetRowValue(std::move(row));
+        return true;
+      }
+      if (key.Is("nullValue")) {
+        bool isNull = false;
+        if (!reader_.ReadBool(isNull)) {
+          return false;
+        }
+        datum.SetNullValue(isNull);
+        return true;
+      }
+      return reader_.SkipValue(depth + 1);
+    });
+  }
+
+  /**
+   * Read a row value.
+   *
+   * @param row Row read.
+   * @param depth Nesting depth of the value.
+   * @return True on success.
+   */
+  bool ReadNestedRow(Row& row, int depth) {
+    return reader_.ReadObject([this, &row, depth](const JsonKey& key) {
+      if (reader_.ReadNull()) {
+        return true;
+      }
+      if (!key.Is("data")) {
+        return reader_.SkipValue(depth + 1);
+      }
+
+      Aws::Vector< Datum > data;
+      bool isRead = reader_.ReadArray([this, &data, depth]() {
+        Datum value;
+        if (!ReadDatum(value, depth + 1)) {
+          return false;
+        }
+        data.push_back(std::move(value));
+        return true;
+      });
+      row.SetData(std::move(data));
+      return isRead;
+    });
+  }
+
+  /** JSON reader. */
+  JsonReader reader_;
+
+  /** Buffer for unescaped values. */
+  std::string buffer_;
+
+  /** Columns of the response. */
+  Aws::Vector< ColumnInfo > columnInfo_;
+
+  /** Decoded columns. */
+  std::vector< DecodedPage::Column > columns_;
+
+  /** Rows holding the values of the columns not decoded. */
+  Aws::Vector< Row > rows_;
+
+  /** Token of the next page. */
+  Aws::String nextToken_;
+
+  /** Flag indicating the columns are read. */
+  bool hasColumns_;
+
+  /** Flag indicating the rows are read. */
+  bool hasRows_;
+
+  /** Flag indicating the token of the next page is read. */
+  bool hasNextToken_;
+
+  /** Number of values a row must have, up to the last decoded column. */
+  size_t minValues_;
+
+  /** Number of values kept in a row, up to the last column not decoded. */
+  size_t keptValues_;
+};
+}  // namespace
+
+std::shared_ptr< DecodedPage > ResponseDecoder::Decode(const char* body,
+                                                       size_t size) {
+  std::shared_ptr< DecodedPage > page = PageReader(body, size).Read();
+  if (!page) {
+    LOG_DEBUG_MSG("Response is not decoded, it is parsed by the SDK");
+  }
+  return page;
+}
+}  // namespace odbc
+}  // namespace iotsitewise
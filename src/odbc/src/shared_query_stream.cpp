@@ -0,0 +1,244 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "iotsitewise/odbc/shared_query_stream.h"
+
+#include <algorithm>
+
+#include <aws/core/http/HttpRequest.h>
+
+#include "iotsitewise/odbc/log.h"
+
+using Aws::IoTSiteWise::Model::ExecuteQueryRequest;
+
+namespace iotsitewise {
+namespace odbc {
+std::mutex SharedQueryStream::registryMutex_;
+
+std::unordered_map< std::string, std::weak_ptr< SharedQueryStream > >
+    SharedQueryStream::registry_;
+
+SharedQueryStream::SharedQueryStream()
+    : released_(1),
+      capacity_(1),
+      isStarted_(false),
+      hasMorePages_(false),
+      isFetching_(false),
+      isFailed_(false),
+      isCancelled_(false),
+      pool_(nullptr) {
+  // No-op.
+}
+
+std::shared_ptr< SharedQueryStream > SharedQueryStream::Acquire(
+    const std::string& key, const void* subscriber, bool& isNew) {
+  std::lock_guard< std::mutex > lock(registryMutex_);
+  std::unordered_map< std::string,
+                      std::weak_ptr< SharedQueryStream > >::iterator it =
+      registry_.find(key);
+  if (it != registry_.end()) {
+    std::shared_ptr< SharedQueryStream > stream = it->second.lock();
+    if (stream && stream->Join(subscriber)) {
+      LOG_DEBUG_MSG("Joining the identical query in flight");
+      isNew = false;
+      return stream;
+    }
+  }
+
+  // drop the streams no execution holds any more
+  for (it = registry_.begin(); it != registry_.end();) {
+    if (it->second.expired()) {
+      it = registry_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  std::shared_ptr< SharedQueryStream > stream =
+      std::make_shared< SharedQueryStream >();
+  stream->Join(subscriber);
+  registry_[key] = stream;
+  isNew = true;
+  return stream;
+}
+
+void SharedQueryStream::Start(
+    const void* subscriber,
+    std::shared_ptr< QueryClient > client,
+    ThreadPool* pool, const ExecuteQueryRequest& request,
+    const Page& firstPage, size_t capacity) {
+  std::lock_guard< std::mutex > lock(mutex_);
+  client_ = client;
+  pool_ = pool;
+  capacity_ = std::max< size_t >(capacity, 1);
+  request_ = request;
+  request_.SetNextToken(firstPage->GetNextToken());
+  // The handler is polled by the HTTP client while the request is in
+  // flight, the request is aborted once all subscribers have left.
+  request_.SetContinueRequestHandler(
+      [this](const Aws::Http::HttpRequest*) { return !isCancelled_; });
+
+  pages_.push_back(firstPage);
+  positions_[subscriber] = 1;
+  isStarted_ = true;
+  hasMorePages_ = !firstPage->GetNextToken().empty();
+  ScheduleFetch();
+  cv_.notify_all();
+}
+
+void SharedQueryStream::Fail(const std::string& error) {
+  std::lock_guard< std::mutex > lock(mutex_);
+  isStarted_ = true;
+  isFailed_ = true;
+  error_ = error;
+  cv_.notify_all();
+}
+
+bool SharedQueryStream::Next(const void* subscriber,
+                             std::chrono::steady_clock::time_point deadline,
+                             Page& page, std::string& error) {
+  std::unique_lock< std::mutex > lock(mutex_);
+  size_t& position = positions_[subscriber];
+  auto isReady = [&]() { return position < pages_.size() || isFailed_; };
+  if (deadline == std::chrono::steady_clock::time_point::max()) {
+    cv_.wait(lock, isReady);
+  } else if (!cv_.wait_until(lock, deadline, isReady)) {
+    error = "Timed out waiting for the page of the shared query";
+    return false;
+  }
+
+  if (position >= pages_.size()) {
+    error = error_;
+    return false;
+  }
+
+  page = pages_[position++];
+  ReleasePages();
+  ScheduleFetch();
+  return true;
+}
+
+void SharedQueryStream::Leave(const void* subscriber) {
+  std::unique_lock< std::mutex > lock(mutex_);
+  positions_.erase(subscriber);
+  if (!positions_.empty()) {
+    ReleasePages();
+    return;
+  }
+
+  // abort the request in flight and wait for the running task to end
+  isCancelled_ = true;
+  hasMorePages_ = false;
+  cv_.wait(lock, [&]() { return !isFetching_; });
+  pages_.clear();
+}
+
+bool SharedQueryStream::Join(const void* subscriber) {
+  std::lock_guard< std::mutex > lock(mutex_);
+  if (isCancelled_ || released_ > 1
+      || (isStarted_ && (isFailed_ || !hasMorePages_))) {
+    return false;
+  }
+
+  positions_[subscriber] = 0;
+  return true;
+}
+
+void SharedQueryStream::FetchOnePage() {
+  LOG_DEBUG_MSG("FetchOnePage is called");
+  if (isCancelled_) {
+    std::lock_guard< std::mutex > lock(mutex_);
+    isFetching_ = false;
+    cv_.notify_all();
+    return;
+  }
+
+  PageOutcome outcome = client_->ExecuteQueryPage(request_);
+
+  std::lock_guard< std::mutex > lock(mutex_);
+  isFetching_ = false;
+  if (isCancelled_) {
+    LOG_DEBUG_MSG("All subscribers have left, drop the fetched page");
+    cv_.notify_all();
+    return;
+  }
+
+  if (!outcome.IsSuccess()) {
+    const auto& error = outcome.GetError();
+    LOG_ERROR_MSG("ERROR: " << error.GetExceptionName() << ": "
+                            << error.GetMessage());
+    isFailed_ = true;
+    error_ = "AWS API Failure: " + error.GetExceptionName() + ": "
+             + error.GetMessage();
+    hasMorePages_ = false;
+    cv_.notify_all();
+    return;
+  }
+
+  // the page is decoded when it is fetched, the subscribers only copy the
+  // values
+  Page page = outcome.GetResultWithOwnership();
+  if (page->GetNextToken().empty()) {
+    hasMorePages_ = false;
+    pages_.push_back(page);
+  } else {
+    request_.SetNextToken(page->GetNextToken());
+    // skip the empty page as there are more pages to come
+    if (!page->GetRows().empty()) {
+      pages_.push_back(page);
+    }
+  }
+  LOG_DEBUG_MSG("Shared query has " << pages_.size() << " pages fetched");
+
+  ScheduleFetch();
+  cv_.notify_all();
+}
+
+void SharedQueryStream::ScheduleFetch() {
+  if (!hasMorePages_ || isFetching_ || isCancelled_ || positions_.empty()) {
+    return;
+  }
+
+  size_t leading = 0;
+  for (const std::pair< const void* const, size_t >& position : positions_) {
+    leading = std::max(leading, position.second);
+  }
+  // the slower subscribers read the pages already fetched, so they do not
+  // hold back the leading one
+  if (pages_.size() >= leading + capacity_) {
+    return;
+  }
+
+  isFetching_ = true;
+  std::shared_ptr< SharedQueryStream > self = shared_from_this();
+  pool_->Submit(this, [self]() { self->FetchOnePage(); });
+}
+
+void SharedQueryStream::ReleasePages() {
+  if (positions_.empty()) {
+    return;
+  }
+
+  size_t trailing = pages_.size();
+  for (const std::pair< const void* const, size_t >& position : positions_) {
+    trailing = std::min(trailing, position.second);
+  }
+  for (; released_ < trailing; released_++) {
+    pages_[released_].reset();
+  }
+}
+}  // namespace odbc
+}  // namespace iotsitewise
@@ -50,10 +50,16 @@ Statement::Statement(Connection& parent)
       rowsFetched(nullptr),
       rowStatuses(nullptr),
       columnBindOffset(nullptr),
+      rowBindType(SQL_BIND_BY_COLUMN),
       cellOffset(0),
       currentColNum(0),
       rowArraySize(1),
-      rowsetSize(1) {
+      rowsetSize(1),
+      prefetchPages(0),
+      queryTimeout(0),
+      maxRows(0),
+      firstPageSize(static_cast< SqlUlen >(
+          parent.GetConfiguration().GetFirstPageSize())) {
   // Create and initialize implicit descriptors. Here we created the 4 implicit
   // descriptors. But besides implicit ARD, they are not in use because there is
   // no clear document about how to set and use them. This could be done in
@@ -409,16 +415,12 @@ SqlResult::Type Statement::InternalSetAttribute(int attr, void* value,
     }
 
     case SQL_ATTR_ROW_BIND_TYPE: {
-      SqlUlen rowBindType = reinterpret_cast< SqlUlen >(value);
+      // SQL_BIND_BY_COLUMN or the size of the structure holding a row
+      rowBindType = reinterpret_cast< SqlUlen >(value);
 
-      if (rowBindType != SQL_BIND_BY_COLUMN) {
-        AddStatusRecord(SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
-                        "Only binding by column is currently supported");
-
-        return SqlResult::AI_ERROR;
-      }
       ard->GetHeader().bindType = rowBindType;
 
+      LOG_DEBUG_MSG("rowBindType: " << rowBindType);
       break;
     }
 
@@ -446,6 +448,57 @@ SqlResult::Type Statement::InternalSetAttribute(int attr, void* value,
       break;
     }
 
+    case SQL_ATTR_SWPREFETCH_PAGES: {
+      SqlUlen val = reinterpret_cast< SqlUlen >(value);
+
+      if (val == 0) {
+        AddStatusRecord(SqlState::SHY024_INVALID_ATTRIBUTE_VALUE,
+                        "Prefetch pages value must be positive");
+
+        return SqlResult::AI_ERROR;
+      }
+
+      prefetchPages = val;
+
+      LOG_DEBUG_MSG("prefetchPages: " << prefetchPages);
+
+      break;
+    }
+
+    case SQL_ATTR_QUERY_TIMEOUT: {
+      SqlUlen val = reinterpret_cast< SqlUlen >(value);
+
+      if (val > static_cast< SqlUlen >(INT32_MAX)) {
+        AddStatusRecord(SqlState::S01S02_OPTION_VALUE_CHANGED,
+                        "Query timeout is too large, changed to max value.");
+        queryTimeout = INT32_MAX;
+
+        return SqlResult::AI_SUCCESS_WITH_INFO;
+      }
+
+      queryTimeout = val;
+
+      LOG_DEBUG_MSG("queryTimeout: " << queryTimeout);
+
+      break;
+    }
+
+    case SQL_ATTR_MAX_ROWS: {
+      maxRows = reinterpret_cast< SqlUlen >(value);
+
+      LOG_DEBUG_MSG("maxRows: " << maxRows);
+
+      break;
+    }
+
+    case SQL_ATTR_SWFIRST_PAGE_SIZE: {
+      firstPageSize = reinterpret_cast< SqlUlen >(value);
+
+      LOG_DEBUG_MSG("firstPageSize: " << firstPageSize);
+
+      break;
+    }
+
     default: {
       LOG_DEBUG_MSG("InternalSetAttribute: Unsupported attribute " << attr << " (0x" << std::hex << attr << std::dec << ")");
       AddStatusRecord(SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
@@ -465,6 +518,8 @@ void Statement::SetAttribute(StatementAttributes& stmtAttr) {
   SetAttribute(SQL_ATTR_RETRIEVE_DATA, reinterpret_cast<SQLPOINTER>(stmtAttr.retrieveData), 0);
   SetAttribute(SQL_ATTR_ROW_ARRAY_SIZE, reinterpret_cast<SQLPOINTER>(stmtAttr.rowArraySize), 0);
   SetAttribute(SQL_ROWSET_SIZE, reinterpret_cast<SQLPOINTER>(stmtAttr.rowsetSize), 0);
+  SetAttribute(SQL_ATTR_QUERY_TIMEOUT, reinterpret_cast<SQLPOINTER>(stmtAttr.queryTimeout), 0);
+  SetAttribute(SQL_ATTR_MAX_ROWS, reinterpret_cast<SQLPOINTER>(stmtAttr.maxRows), 0);
 }
 
 void Statement::GetAttribute(int attr, void* buf, SQLINTEGER bufLen,
@@ -614,7 +669,7 @@ SqlResult::Type Statement::InternalGetAttribute(int attr, void* buf, SQLINTEGER,
     case SQL_ATTR_ROW_BIND_TYPE: {
       SqlUlen* val = reinterpret_cast< SqlUlen* >(buf);
 
-      *val = SQL_BIND_BY_COLUMN;
+      *val = rowBindType;
 
       break;
     }
@@ -685,6 +740,62 @@ SqlResult::Type Statement::InternalGetAttribute(int attr, void* buf, SQLINTEGER,
       break;
     }
 
+    case SQL_ATTR_SWPREFETCH_PAGES: {
+      SqlUlen* val = reinterpret_cast< SqlUlen* >(buf);
+
+      *val = GetPrefetchPages();
+
+      if (valueLen) {
+        *valueLen = SQL_IS_UINTEGER;
+      }
+
+      LOG_DEBUG_MSG("*val is " << (val ? *val : 0) << ", *valueLen is "
+                               << (valueLen ? *valueLen : 0));
+      break;
+    }
+
+    case SQL_ATTR_QUERY_TIMEOUT: {
+      SqlUlen* val = reinterpret_cast< SqlUlen* >(buf);
+
+      *val = queryTimeout;
+
+      if (valueLen) {
+        *valueLen = SQL_IS_UINTEGER;
+      }
+
+      LOG_DEBUG_MSG("*val is " << (val ? *val : 0) << ", *valueLen is "
+                               << (valueLen ? *valueLen : 0));
+      break;
+    }
+
+    case SQL_ATTR_MAX_ROWS: {
+      SqlUlen* val = reinterpret_cast< SqlUlen* >(buf);
+
+      *val = maxRows;
+
+      if (valueLen) {
+        *valueLen = SQL_IS_UINTEGER;
+      }
+
+      LOG_DEBUG_MSG("*val is " << (val ? *val : 0) << ", *valueLen is "
+                               << (valueLen ? *valueLen : 0));
+      break;
+    }
+
+    case SQL_ATTR_SWFIRST_PAGE_SIZE: {
+      SqlUlen* val = reinterpret_cast< SqlUlen* >(buf);
+
+      *val = firstPageSize;
+
+      if (valueLen) {
+        *valueLen = SQL_IS_UINTEGER;
+      }
+
+      LOG_DEBUG_MSG("*val is " << (val ? *val : 0) << ", *valueLen is "
+                               << (valueLen ? *valueLen : 0));
+      break;
+    }
+
     default: {
       LOG_DEBUG_MSG("InternalGetAttribute: Unsupported attribute " << attr << " (0x" << std::hex << attr << std::dec << ")");
       AddStatusRecord(SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
@@ -757,7 +868,8 @@ SqlResult::Type Statement::InternalPrepareSqlQuery(const std::string& query) {
     currentQuery->Close();
   }
 
-  currentQuery.reset(new query::DataQuery(*this, connection, query));
+  currentQuery.reset(
+      new query::DataQuery(*this, connection, query, GetPrefetchPages()));
 
   return SqlResult::AI_SUCCESS;
 }
@@ -766,6 +878,15 @@ void Statement::ExecuteSqlQuery(const std::string& query) {
   IGNITE_ODBC_API_CALL(InternalExecuteSqlQuery(query));
 }
 
+SqlUlen Statement::GetPrefetchPages() const {
+  if (prefetchPages > 0) {
+    return prefetchPages;
+  }
+
+  return static_cast< SqlUlen >(
+      connection.GetConfiguration().GetPrefetchPages());
+}
+
 SqlResult::Type Statement::InternalExecuteSqlQuery(const std::string& query) {
   LOG_DEBUG_MSG("InternalExecuteSqlQuery is called for query " << query);
   SqlResult::Type result = InternalPrepareSqlQuery(query);
@@ -789,6 +910,17 @@ SqlResult::Type Statement::InternalExecuteSqlQuery() {
     return SqlResult::AI_ERROR;
   }
 
+  if (currentQuery->GetType() == query::QueryType::DATA) {
+    static_cast< query::DataQuery* >(currentQuery.get())
+        ->SetQueryTimeout(static_cast< int32_t >(queryTimeout));
+    static_cast< query::DataQuery* >(currentQuery.get())
+        ->SetMaxRows(static_cast< size_t >(maxRows));
+    static_cast< query::DataQuery* >(currentQuery.get())
+        ->SetFirstPageSize(static_cast< size_t >(firstPageSize));
+    static_cast< query::DataQuery* >(currentQuery.get())
+        ->SetPrefetchPages(static_cast< size_t >(GetPrefetchPages()));
+  }
+
   SqlResult::Type retval = currentQuery->Execute();
   // For SQLExecute() when the query result is empty according to Microsoft
   // document it should be SUCCESS. SQL_NO_DATA is only used for DML statements.
@@ -1059,6 +1191,17 @@ SqlResult::Type Statement::InternalClose(bool ignoreErrors) {
   return ignoreErrors ? SqlResult::AI_SUCCESS : result;
 }
 
+void Statement::PrepareColumnBindings() {
+  // If columnBindOffset is NULL we want to make sure offsets still
+  // have a value, namely a value of 0
+  SqlUlen columnBindOffsetValue = columnBindOffset ? *columnBindOffset : 0;
+  for (app::ColumnBindingMap::iterator it = columnBindings.begin();
+       it != columnBindings.end(); ++it) {
+    it->second.SetByteOffset(columnBindOffsetValue);
+    it->second.SetBindType(rowBindType);
+  }
+}
+
 void Statement::ExtendedFetch(SQLUSMALLINT orientation, SQLLEN offset, SQLULEN* rowCount, SQLUSMALLINT* rowStatusArray) {
     IGNITE_ODBC_API_CALL(InternalExtendedFetch(orientation, offset, rowCount, rowStatusArray));
 }
@@ -1084,27 +1227,23 @@ SqlResult::Type Statement::InternalExtendedFetch(SQLUSMALLINT orientation, SQLLE
     *rowCount = 0;
   }
 
-  // offset (aka FetchOffset) is ignored. Byte offsets are
-  // explicitly set to 0 to indicate that bind offsets are not supported
-  for (app::ColumnBindingMap::iterator it = columnBindings.begin();
-    it != columnBindings.end(); ++it) {
-    it->second.SetByteOffset(0);
-  }
+  // offset (aka FetchOffset) is ignored.
+  PrepareColumnBindings();
 
   SqlUlen fetched = 0;
   SqlUlen errors = 0;
+  SqlUlen warnings = 0;
 
   LOG_DEBUG_MSG("rowsetSize is " << rowsetSize);
+  currentQuery->FetchNextRows(columnBindings, rowsetSize, rowResults);
   for (SqlUlen i = 0; i < rowsetSize; ++i) {
-    for (app::ColumnBindingMap::iterator it = columnBindings.begin();
-      it != columnBindings.end(); ++it) {
-      it->second.SetElementOffset(i);
-    }
-
-    SqlResult::Type res = currentQuery->FetchNextRow(columnBindings);
+    SqlResult::Type res = rowResults[i];
 
     if (res == SqlResult::AI_SUCCESS || res == SqlResult::AI_SUCCESS_WITH_INFO) {
       ++fetched;
+      if (res == SqlResult::AI_SUCCESS_WITH_INFO) {
+        ++warnings;
+      }
     } else if (res != SqlResult::AI_NO_DATA) {
       ++errors;
     }
@@ -1122,7 +1261,7 @@ SqlResult::Type Statement::InternalExtendedFetch(SQLUSMALLINT orientation, SQLLE
     << ", errors is " << errors);
 
   if (fetched > 0) {
-    return errors == 0 ? SqlResult::AI_SUCCESS
+    return errors == 0 && warnings == 0 ? SqlResult::AI_SUCCESS
       : SqlResult::AI_SUCCESS_WITH_INFO;
   }
   
@@ -1168,27 +1307,22 @@ SqlResult::Type Statement::InternalFetchRow() {
   // We're fetching a new row, ensure cellOffset is reset.
   cellOffset = 0;
 
-  // If columnBindOffset is NULL we want to make sure offsets still
-  // have a value, namely a value of 0
-  SqlUlen columnBindOffsetValue = columnBindOffset ? *columnBindOffset : 0;
-  for (app::ColumnBindingMap::iterator it = columnBindings.begin();
-    it != columnBindings.end(); ++it)
-    it->second.SetByteOffset(columnBindOffsetValue);
+  PrepareColumnBindings();
 
   SqlUlen fetched = 0;
   SqlUlen errors = 0;
+  SqlUlen warnings = 0;
 
   LOG_DEBUG_MSG("rowArraySize is " << rowArraySize);
+  currentQuery->FetchNextRows(columnBindings, rowArraySize, rowResults);
   for (SqlUlen i = 0; i < rowArraySize; ++i) {
-    for (app::ColumnBindingMap::iterator it = columnBindings.begin();
-      it != columnBindings.end(); ++it) {
-      it->second.SetElementOffset(i);
-    }
-
-    SqlResult::Type res = currentQuery->FetchNextRow(columnBindings);
+    SqlResult::Type res = rowResults[i];
 
     if (res == SqlResult::AI_SUCCESS || res == SqlResult::AI_SUCCESS_WITH_INFO) {
       ++fetched;
+      if (res == SqlResult::AI_SUCCESS_WITH_INFO) {
+        ++warnings;
+      }
     } else if (res != SqlResult::AI_NO_DATA) {
       ++errors;
     }
@@ -1203,8 +1337,8 @@ SqlResult::Type Statement::InternalFetchRow() {
   }
 
   if (fetched > 0) {
-    return errors == 0 ? SqlResult::AI_SUCCESS
-                       : SqlResult::AI_SUCCESS_WITH_INFO;
+    return errors == 0 && warnings == 0 ? SqlResult::AI_SUCCESS
+                                        : SqlResult::AI_SUCCESS_WITH_INFO;
   }
 
   LOG_DEBUG_MSG("rowsFetched is " << rowsFetched << ", fetched is " << fetched
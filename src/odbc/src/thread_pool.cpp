@@ -0,0 +1,126 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "iotsitewise/odbc/thread_pool.h"
+
+#include <sstream>
+
+#include "iotsitewise/odbc/log.h"
+#include "iotsitewise/odbc/utils.h"
+#include <ignite/common/include/common/platform_utils.h>
+
+namespace iotsitewise {
+namespace odbc {
+std::mutex ThreadPool::instanceMutex_;
+std::weak_ptr< ThreadPool > ThreadPool::instance_;
+
+ThreadPool::ThreadPool(size_t size)
+    : size_(size > 0 ? size : 1), isStopping_(false) {
+  // No-op.
+}
+
+ThreadPool::~ThreadPool() {
+  LOG_DEBUG_MSG("~ThreadPool is called");
+  {
+    std::lock_guard< std::mutex > lock(mutex_);
+    isStopping_ = true;
+  }
+  cv_.notify_all();
+
+  for (std::thread& worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+
+std::shared_ptr< ThreadPool > ThreadPool::GetInstance() {
+  std::lock_guard< std::mutex > lock(instanceMutex_);
+  std::shared_ptr< ThreadPool > pool = instance_.lock();
+  if (!pool) {
+    size_t size = DEFAULT_THREAD_POOL_SIZE;
+    std::string value = ignite::odbc::common::GetEnv("SW_THREAD_POOL_SIZE");
+    if (!value.empty() && value.size() < 6
+        && iotsitewise::odbc::common::AllDigits(value)) {
+      std::stringstream conv(value);
+      conv >> size;
+    } else if (!value.empty()) {
+      LOG_WARNING_MSG("Invalid SW_THREAD_POOL_SIZE value "
+                      << value << ", using default value "
+                      << DEFAULT_THREAD_POOL_SIZE);
+    }
+
+    pool = std::make_shared< ThreadPool >(size);
+    instance_ = pool;
+    LOG_INFO_MSG("Thread pool is created with " << pool->GetSize()
+                                                << " threads");
+  }
+
+  return pool;
+}
+
+void ThreadPool::Submit(const void* owner, Task task) {
+  std::lock_guard< std::mutex > lock(mutex_);
+  if (workers_.size() < size_) {
+    // start the workers lazily, one per submitted task at most
+    workers_.emplace_back(&ThreadPool::Run, this);
+  }
+
+  std::deque< Task >& ownerTasks = tasks_[owner];
+  if (ownerTasks.empty()) {
+    owners_.push_back(owner);
+  }
+  ownerTasks.push_back(std::move(task));
+  cv_.notify_one();
+}
+
+void ThreadPool::Run() {
+  while (true) {
+    Task task;
+    {
+      std::unique_lock< std::mutex > lock(mutex_);
+      cv_.wait(lock, [&]() { return !owners_.empty() || isStopping_; });
+
+      if (owners_.empty()) {
+        // the pool is stopping and all tasks are done
+        return;
+      }
+
+      const void* owner = owners_.front();
+      owners_.pop_front();
+
+      std::map< const void*, std::deque< Task > >::iterator it =
+          tasks_.find(owner);
+      task = std::move(it->second.front());
+      it->second.pop_front();
+
+      if (it->second.empty()) {
+        tasks_.erase(it);
+      } else {
+        // serve the other owners before the next task of this owner
+        owners_.push_back(owner);
+      }
+    }
+
+    try {
+      task();
+    } catch (const std::exception& e) {
+      LOG_ERROR_MSG("Thread pool task failed: " << e.what());
+    }
+  }
+}
+}  // namespace odbc
+}  // namespace iotsitewise
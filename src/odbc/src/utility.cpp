@@ -20,10 +20,22 @@
 
 #include "iotsitewise/odbc/utility.h"
 
+#include <cctype>
+#include <cerrno>
+#include <clocale>
+#include <cmath>
 #include <codecvt>
+#include <cstdlib>
+#include <cstring>
 #include <regex>
 #include <iomanip>
 
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
+
+#include <aws/core/utils/HashingUtils.h>
+
 #include "iotsitewise/odbc/system/odbc_constants.h"
 #include "iotsitewise/odbc/log.h"
 
@@ -96,125 +108,224 @@ size_t CopyUtf8StringToSqlCharString(const char* inBuffer, SQLCHAR* outBuffer,
   }
 }
 
-template < typename OutCharT >
-size_t CopyUtf8StringToWcharString(const char* inBuffer, OutCharT* outBuffer,
-                                   size_t outBufferLenBytes,
-                                   bool& isTruncated) {
-  LOG_DEBUG_MSG(
-      "CopyUtf8StringToWcharString is called with outBufferLenBytes is "
-      << outBufferLenBytes);
-  if (!inBuffer || (outBuffer && outBufferLenBytes == 0)) {
-    return 0;
-  }
+namespace {
+/** Replacement of an invalid utf-8 byte. */
+const uint32_t REPLACEMENT_CHAR = 0xFFFD;
 
-  size_t wCharSize = sizeof(SQLWCHAR);
-  // This is intended to convert to the SQLWCHAR. Ensure we have the same size.
-  assert(sizeof(OutCharT) == wCharSize);
-  assert((outBufferLenBytes % wCharSize) == 0);
-
-  // The number of characters that can be safely transfered, excluding the
-  // null terminating character.
-  size_t outBufferLenChars;
-  // Find the length (in bytes) of the input string.
-  // This does NOT include the null-terminating character.
-  size_t inBufferLen = std::strlen(inBuffer);
-  OutCharT* pOutBuffer;
-  std::vector< OutCharT > targetProxy;
+/**
+ * Check if 8 bytes are all ASCII characters.
+ *
+ * @param str String with at least 8 bytes.
+ * @return @c true if the bytes are ASCII characters.
+ */
+inline bool IsAsciiWord(const unsigned char* str) {
+  uint64_t word;
+  memcpy(&word, str, sizeof(word));
+  return (word & 0x8080808080808080ULL) == 0;
+}
 
-  // outBufferLenBytes must be greater than wCharSize to allow
-  // at least space for a null character and a single character.
-  if (outBuffer && outBufferLenBytes > wCharSize) {
-    pOutBuffer = reinterpret_cast< OutCharT* >(outBuffer);
-    outBufferLenChars = (outBufferLenBytes / wCharSize) - 1;
+/**
+ * Decode a utf-8 character.
+ *
+ * @param str String, not empty.
+ * @param len Length of the string.
+ * @param codePoint Decoded character, U+FFFD if the first byte does not
+ * start a valid sequence.
+ * @return Number of bytes of the character.
+ */
+inline size_t DecodeUtf8Char(const unsigned char* str, size_t len,
+                             uint32_t& codePoint) {
+  unsigned char lead = str[0];
+  if (lead < 0x80) {
+    codePoint = lead;
+    return 1;
+  }
+
+  size_t size;
+  // the bounds of the second byte reject overlong forms and surrogates
+  unsigned char low = 0x80;
+  unsigned char high = 0xBF;
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    size = 2;
+    codePoint = lead & 0x1F;
+  } else if (lead >= 0xE0 && lead <= 0xEF) {
+    size = 3;
+    codePoint = lead & 0x0F;
+    if (lead == 0xE0) {
+      low = 0xA0;
+    } else if (lead == 0xED) {
+      high = 0x9F;
+    }
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    size = 4;
+    codePoint = lead & 0x07;
+    if (lead == 0xF0) {
+      low = 0x90;
+    } else if (lead == 0xF4) {
+      high = 0x8F;
+    }
   } else {
-    // Creates a proxy buffer so we can determine the required length.
-    // This buffer will be ignored and automatically deleted after use.
-    targetProxy.resize(inBufferLen + 1);
-    pOutBuffer = targetProxy.data();
-    outBufferLenChars = inBufferLen;
-  }
-  LOG_DEBUG_MSG("inBufferLen is " << inBufferLen << ", outBufferLenChars is "
-                                  << outBufferLenChars);
-
-  // Setup conversion facet.
-  const std::codecvt_utf8< OutCharT > convFacet;
-  std::mbstate_t convState = std::mbstate_t();
-  // Pointer to next for input.
-  const char* pInBufferNext;
-  // Pointer to next for output.
-  OutCharT* pOutBufferNext;
-
-  // translate characters:
-  const char* inBufferEnd = (inBuffer + inBufferLen);
-  std::codecvt_base::result result =
-      convFacet.in(convState, inBuffer, inBufferEnd, pInBufferNext, pOutBuffer,
-                   pOutBuffer + outBufferLenChars, pOutBufferNext);
-  LOG_DEBUG_MSG("result is " << result);
-
-  size_t lenConverted = 0;
-  switch (result) {
-    case std::codecvt_base::ok:
-    case std::codecvt_base::partial:
-      // The number of characters converted (in OutCharT)
-      lenConverted = pOutBufferNext - pOutBuffer;
-      // null-terminate target string, if room
-      pOutBuffer[lenConverted] = 0;
-
-      isTruncated = (result == std::codecvt_base::partial
-                     || (inBufferEnd != pInBufferNext));
-      break;
-    case std::codecvt_base::error:
-      // Error returned if unable to convert character.
-      LOG_ERROR_MSG("Unable to convert character '" << *pInBufferNext << "'");
+    codePoint = REPLACEMENT_CHAR;
+    return 1;
+  }
 
-      // The number of characters converted (in OutCharT)
-      lenConverted = pOutBufferNext - pOutBuffer;
-      // null-terminate target string, if room.
-      pOutBuffer[lenConverted] = 0;
+  if (len < size || str[1] < low || str[1] > high) {
+    codePoint = REPLACEMENT_CHAR;
+    return 1;
+  }
+  codePoint = (codePoint << 6) | (str[1] & 0x3F);
+  for (size_t i = 2; i < size; i++) {
+    if ((str[i] & 0xC0) != 0x80) {
+      codePoint = REPLACEMENT_CHAR;
+      return 1;
+    }
+    codePoint = (codePoint << 6) | (str[i] & 0x3F);
+  }
+  return size;
+}
 
-      isTruncated = true;
+/**
+ * Count the utf-8 string as SQLWCHAR.
+ *
+ * @param str String.
+ * @param len Length of the string, in bytes.
+ * @return Number of SQLWCHAR.
+ */
+size_t CountSqlWchars(const unsigned char* str, size_t len) {
+  size_t count = 0;
+  size_t i = 0;
+  while (i < len) {
+    while (i + 8 <= len && IsAsciiWord(str + i)) {
+      i += 8;
+      count += 8;
+    }
+    if (i >= len) {
       break;
-    default:
-      // This situation occurs if the source and target are the same encoding.
-      // Impossible?
-      LOG_ERROR_MSG("Unexpected error converting string '" << inBuffer << "'");
-      assert(false);
+    }
+
+    uint32_t codePoint;
+    i += DecodeUtf8Char(str + i, len - i, codePoint);
+    count += (sizeof(SQLWCHAR) == 2 && codePoint > 0xFFFF) ? 2 : 1;
+  }
+  return count;
+}
+}  // namespace
+
+size_t TranscodeUtf8ToSqlWchar(const char* inBuffer, size_t inBufferLenBytes,
+                               SQLWCHAR* outBuffer, size_t outBufferLenBytes,
+                               size_t& bytesRead, size_t& bytesWritten) {
+  bytesRead = 0;
+  bytesWritten = 0;
+  if (!inBuffer) {
+    return 0;
+  }
+
+  const unsigned char* in = reinterpret_cast< const unsigned char* >(inBuffer);
+  size_t inLen = inBufferLenBytes;
+  // The number of characters that can be copied, excluding the null
+  // terminating character.
+  size_t outLen = 0;
+  if (outBuffer && outBufferLenBytes >= sizeof(SQLWCHAR)) {
+    outLen = outBufferLenBytes / sizeof(SQLWCHAR) - 1;
+  }
+
+  size_t i = 0;
+  size_t written = 0;
+  while (i < inLen) {
+    // most values are ASCII, copy them a word at a time
+    while (i + 8 <= inLen && written + 8 <= outLen && IsAsciiWord(in + i)) {
+      for (size_t k = 0; k < 8; k++) {
+        outBuffer[written + k] = static_cast< SQLWCHAR >(in[i + k]);
+      }
+      i += 8;
+      written += 8;
+    }
+    if (i >= inLen) {
       break;
+    }
+
+    uint32_t codePoint;
+    size_t size = DecodeUtf8Char(in + i, inLen - i, codePoint);
+    if (sizeof(SQLWCHAR) == 2 && codePoint > 0xFFFF) {
+      if (written + 2 > outLen) {
+        break;
+      }
+      codePoint -= 0x10000;
+      outBuffer[written++] = static_cast< SQLWCHAR >(0xD800 + (codePoint >> 10));
+      outBuffer[written++] =
+          static_cast< SQLWCHAR >(0xDC00 + (codePoint & 0x3FF));
+    } else {
+      if (written + 1 > outLen) {
+        break;
+      }
+      outBuffer[written++] = static_cast< SQLWCHAR >(codePoint);
+    }
+    i += size;
   }
 
-  LOG_DEBUG_MSG("lenConverted is " << lenConverted);
+  if (outBuffer && outBufferLenBytes >= sizeof(SQLWCHAR)) {
+    outBuffer[written] = 0;
+  }
+  bytesRead = i;
+  bytesWritten = written * sizeof(SQLWCHAR);
 
-  // Return the number of bytes transferred.
-  return lenConverted * wCharSize;
+  size_t total = written + CountSqlWchars(in + i, inLen - i);
+  return total * sizeof(SQLWCHAR);
+}
+
+size_t CountUtf8Chars(const char* inBuffer, size_t inBufferLenBytes) {
+  if (!inBuffer) {
+    return 0;
+  }
+
+  const unsigned char* in = reinterpret_cast< const unsigned char* >(inBuffer);
+  size_t count = 0;
+  size_t i = 0;
+  while (i < inBufferLenBytes) {
+    while (i + 8 <= inBufferLenBytes && IsAsciiWord(in + i)) {
+      i += 8;
+      count += 8;
+    }
+    if (i >= inBufferLenBytes) {
+      break;
+    }
+
+    uint32_t codePoint;
+    i += DecodeUtf8Char(in + i, inBufferLenBytes - i, codePoint);
+    count++;
+  }
+  return count;
 }
 
 size_t CopyUtf8StringToSqlWcharString(const char* inBuffer, SQLWCHAR* outBuffer,
                                       size_t outBufferLenBytes,
                                       bool& isTruncated) {
   LOG_DEBUG_MSG(
-      "CopyUtf8StringToWcharString is called with outBufferLenBytes is "
+      "CopyUtf8StringToSqlWcharString is called with outBufferLenBytes is "
       << outBufferLenBytes);
-  if (!inBuffer) {
+  if (!inBuffer || (outBuffer && outBufferLenBytes == 0)) {
     return 0;
   }
 
-  // Handles SQLWCHAR if either UTF-16 and UTF-32
-  size_t wCharSize = sizeof(SQLWCHAR);
-  LOG_DEBUG_MSG("wCharSize is " << wCharSize);
-  switch (wCharSize) {
-    case 2:
-      return CopyUtf8StringToWcharString(
-          inBuffer, reinterpret_cast< char16_t* >(outBuffer), outBufferLenBytes,
-          isTruncated);
-    case 4:
-      return CopyUtf8StringToWcharString(
-          inBuffer, reinterpret_cast< char32_t* >(outBuffer), outBufferLenBytes,
-          isTruncated);
-    default:
-      LOG_ERROR_MSG("Unexpected error converting string '" << inBuffer << "'");
-      assert(false);
-      return 0;
+  // This does NOT include the null-terminating character.
+  size_t inBufferLen = std::strlen(inBuffer);
+  size_t bytesRead = 0;
+  size_t bytesWritten = 0;
+
+  // outBufferLenBytes must be greater than the size of SQLWCHAR to allow
+  // at least space for a null character and a single character.
+  if (outBuffer && outBufferLenBytes > sizeof(SQLWCHAR)) {
+    TranscodeUtf8ToSqlWchar(inBuffer, inBufferLen, outBuffer,
+                            outBufferLenBytes, bytesRead, bytesWritten);
+    isTruncated = bytesRead < inBufferLen;
+    LOG_DEBUG_MSG("bytesWritten is " << bytesWritten);
+    return bytesWritten;
   }
+
+  // Only determine the required length.
+  isTruncated = false;
+  return TranscodeUtf8ToSqlWchar(inBuffer, inBufferLen, nullptr, 0, bytesRead,
+                                 bytesWritten);
 }
 
 // High-level entry point to handle buffer size in either bytes or characters
@@ -350,6 +461,13 @@ std::string HexDump(const void* data, size_t count) {
   return dump.str();
 }
 
+std::string Sha256Hex(const std::string& value) {
+  Aws::Utils::ByteBuffer digest = Aws::Utils::HashingUtils::CalculateSHA256(
+      Aws::String(value.data(), value.size()));
+  Aws::String hex = Aws::Utils::HashingUtils::HexEncode(digest);
+  return std::string(hex.data(), hex.size());
+}
+
 std::string Ltrim(const std::string& s) {
   return std::regex_replace(s, std::regex("^\\s+"), std::string(""));
 }
@@ -453,6 +571,230 @@ long StringToLong(const std::string& s, size_t* idx, int base) {
   return retval;
 }
 
+namespace {
+/**
+ * Reads a fixed number of decimal digits.
+ * @param str digits
+ * @param count number of digits
+ * @param value read value
+ *
+ * @return true if all characters are digits
+ */
+bool ReadDigits(const char* str, size_t count, int32_t& value) {
+  value = 0;
+  for (size_t i = 0; i < count; i++) {
+    uint32_t digit = static_cast< unsigned char >(str[i]) - '0';
+    if (digit > 9) {
+      return false;
+    }
+    value = value * 10 + static_cast< int32_t >(digit);
+  }
+  return true;
+}
+
+/**
+ * Parses a number with strtod in the "C" locale.
+ * @param str number string, it must be terminated by a character that is
+ * not part of a number
+ * @param end set to the character past the number
+ *
+ * @return parsed value
+ */
+double StrtodC(const char* str, char** end) {
+#ifdef _WIN32
+  static const _locale_t locale = _create_locale(LC_NUMERIC, "C");
+  return _strtod_l(str, end, locale);
+#else
+  static const locale_t locale = newlocale(LC_NUMERIC_MASK, "C", nullptr);
+  return strtod_l(str, end, locale);
+#endif
+}
+
+/**
+ * Gets the number of days from Jan 1, 1970 to a date of the proleptic
+ * Gregorian calendar, see
+ * http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+ * @param year year
+ * @param month month in range [1..12]
+ * @param day day of the month, the days past the end of the month are
+ * counted into the next one like timegm does
+ *
+ * @return number of days
+ */
+int64_t DaysFromCivil(int64_t year, uint32_t month, uint32_t day) {
+  year -= month <= 2 ? 1 : 0;
+  const int64_t era = (year >= 0 ? year : year - 399) / 400;
+  const uint32_t yearOfEra = static_cast< uint32_t >(year - era * 400);
+  const uint32_t dayOfYear =
+      (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const uint32_t dayOfEra =
+      yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return era * 146097 + static_cast< int64_t >(dayOfEra) - 719468;
+}
+}  // namespace
+
+bool ParseDouble(const char* str, size_t len, double& value) {
+  // powers of ten represented exactly as double
+  static const double POWERS_OF_TEN[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  static const int MAX_EXACT_POWER = 22;
+  static const int MAX_MANTISSA_DIGITS = 19;
+  static const uint64_t MAX_EXACT_MANTISSA = 1ULL << 53;
+
+  if (len == 0 || std::isspace(static_cast< unsigned char >(str[0]))) {
+    return false;
+  }
+
+  const char* pos = str;
+  const char* end = str + len;
+  bool isNegative = false;
+  if (*pos == '-' || *pos == '+') {
+    isNegative = *pos == '-';
+    ++pos;
+  }
+
+  uint64_t mantissa = 0;
+  int digits = 0;
+  int exponent = 0;
+  bool hasDigits = false;
+  bool isExact = true;
+  bool isFraction = false;
+  for (; pos != end; ++pos) {
+    uint32_t digit = static_cast< unsigned char >(*pos) - '0';
+    if (digit <= 9) {
+      hasDigits = true;
+      if (digits == MAX_MANTISSA_DIGITS) {
+        isExact = false;
+        break;
+      }
+      mantissa = mantissa * 10 + digit;
+      digits += mantissa == 0 ? 0 : 1;
+      exponent -= isFraction ? 1 : 0;
+    } else if (*pos == '.' && !isFraction) {
+      isFraction = true;
+    } else {
+      break;
+    }
+  }
+
+  if (isExact && hasDigits && pos != end && (*pos == 'e' || *pos == 'E')) {
+    ++pos;
+    bool isNegativeExponent = false;
+    if (pos != end && (*pos == '-' || *pos == '+')) {
+      isNegativeExponent = *pos == '-';
+      ++pos;
+    }
+    int explicitExponent = 0;
+    const char* exponentStart = pos;
+    for (; pos != end && *pos >= '0' && *pos <= '9'; ++pos) {
+      if (explicitExponent < 100000) {
+        explicitExponent = explicitExponent * 10 + (*pos - '0');
+      }
+    }
+    if (pos == exponentStart) {
+      return false;
+    }
+    exponent += isNegativeExponent ? -explicitExponent : explicitExponent;
+  }
+
+  // The mantissa and the power of ten are exact, so the one rounding of the
+  // multiplication or division gives the closest double.
+  if (isExact && hasDigits && pos == end && mantissa <= MAX_EXACT_MANTISSA
+      && exponent >= -MAX_EXACT_POWER && exponent <= MAX_EXACT_POWER) {
+    double result = static_cast< double >(mantissa);
+    result = exponent < 0 ? result / POWERS_OF_TEN[-exponent]
+                          : result * POWERS_OF_TEN[exponent];
+    value = isNegative ? -result : result;
+    return true;
+  }
+
+  // long mantissas, large exponents, hexadecimal, infinity and NaN, while a
+  // malformed value is rejected by strtod
+  std::string copy(str, len);
+  char* parsedEnd = nullptr;
+  errno = 0;
+  double result = StrtodC(copy.c_str(), &parsedEnd);
+  if (parsedEnd != copy.c_str() + len
+      || (errno == ERANGE && std::isinf(result))) {
+    return false;
+  }
+  value = result;
+  return true;
+}
+
+bool ParseInt32(const char* str, size_t len, int32_t& value) {
+  const char* pos = str;
+  const char* end = str + len;
+  bool isNegative = false;
+  if (pos != end && (*pos == '-' || *pos == '+')) {
+    isNegative = *pos == '-';
+    ++pos;
+  }
+  if (pos == end) {
+    return false;
+  }
+
+  const int64_t limit = isNegative ? -static_cast< int64_t >(INT32_MIN)
+                                   : static_cast< int64_t >(INT32_MAX);
+  int64_t result = 0;
+  for (; pos != end; ++pos) {
+    uint32_t digit = static_cast< unsigned char >(*pos) - '0';
+    if (digit > 9) {
+      return false;
+    }
+    result = result * 10 + digit;
+    if (result > limit) {
+      return false;
+    }
+  }
+  value = static_cast< int32_t >(isNegative ? -result : result);
+  return true;
+}
+
+bool ParseUtcTimestamp(const char* str, size_t len, int64_t& seconds,
+                       int32_t& fractionNs) {
+  static const size_t SECONDS_LEN = 19;
+  static const size_t MAX_FRACTION_DIGITS = 9;
+  static const int32_t FRACTION_SCALE[MAX_FRACTION_DIGITS + 1] = {
+      1000000000, 100000000, 10000000, 1000000, 100000,
+      10000,      1000,      100,      10,      1};
+
+  if (len < SECONDS_LEN || str[4] != '-' || str[7] != '-' || str[10] != ' '
+      || str[13] != ':' || str[16] != ':') {
+    return false;
+  }
+
+  int32_t year, month, day, hour, minute, second;
+  if (!ReadDigits(str, 4, year) || !ReadDigits(str + 5, 2, month)
+      || !ReadDigits(str + 8, 2, day) || !ReadDigits(str + 11, 2, hour)
+      || !ReadDigits(str + 14, 2, minute)
+      || !ReadDigits(str + 17, 2, second)) {
+    return false;
+  }
+
+  // a leap second is counted into the next minute like timegm does
+  if (month < 1 || month > 12 || day < 1 || day > 31 || hour > 23
+      || minute > 59 || second > 60) {
+    return false;
+  }
+
+  int32_t fraction = 0;
+  if (len > SECONDS_LEN) {
+    size_t digits = len - SECONDS_LEN - 1;
+    if (str[SECONDS_LEN] != '.' || digits == 0 || digits > MAX_FRACTION_DIGITS
+        || !ReadDigits(str + SECONDS_LEN + 1, digits, fraction)) {
+      return false;
+    }
+    fraction *= FRACTION_SCALE[digits];
+  }
+
+  seconds = DaysFromCivil(year, month, day) * 86400 + hour * 3600
+            + minute * 60 + second;
+  fractionNs = fraction;
+  return true;
+}
+
 bool CheckEnvVarSetToTrue(const std::string& envVar) {
   std::string envVarVal = ignite::odbc::common::GetEnv(envVar);
   std::transform(envVarVal.begin(), envVarVal.end(), envVarVal.begin(),
@@ -0,0 +1,65 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+#include "iotsitewise/odbc/validation_mode.h"
+
+#include <iotsitewise/odbc/utils.h>
+#include <iotsitewise/odbc/utility.h>
+
+namespace iotsitewise {
+namespace odbc {
+ValidationMode::Type ValidationMode::FromString(const std::string& val,
+                                                Type dflt) {
+  std::string mode = utility::Trim(iotsitewise::odbc::common::ToLower(val));
+
+  if (mode == "full") {
+    return ValidationMode::Type::FULL;
+  }
+
+  if (mode == "light") {
+    return ValidationMode::Type::LIGHT;
+  }
+
+  if (mode == "once") {
+    return ValidationMode::Type::ONCE;
+  }
+
+  if (mode == "lazy") {
+    return ValidationMode::Type::LAZY;
+  }
+
+  return dflt;
+}
+
+std::string ValidationMode::ToString(Type val) {
+  switch (val) {
+    case ValidationMode::Type::FULL:
+      return "full";
+
+    case ValidationMode::Type::LIGHT:
+      return "light";
+
+    case ValidationMode::Type::ONCE:
+      return "once";
+
+    case ValidationMode::Type::LAZY:
+      return "lazy";
+
+    default:
+      return "unknown";
+  }
+}
+}  // namespace odbc
+}  // namespace iotsitewise
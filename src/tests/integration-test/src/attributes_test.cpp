@@ -292,6 +292,42 @@ BOOST_AUTO_TEST_CASE(StatementAttributeCursorType) {
                       GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
 }
 
+BOOST_AUTO_TEST_CASE(StatementAttributeQueryTimeout) {
+  ConnectToSW();
+
+  SQLULEN timeout = -1;
+  SQLRETURN ret = SQLGetStmtAttr(stmt, SQL_ATTR_QUERY_TIMEOUT, &timeout, 0, 0);
+
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+  BOOST_REQUIRE_EQUAL(timeout, 0);
+
+  ret = SQLSetStmtAttr(stmt, SQL_ATTR_QUERY_TIMEOUT,
+                       reinterpret_cast< SQLPOINTER >(30), 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLGetStmtAttr(stmt, SQL_ATTR_QUERY_TIMEOUT, &timeout, 0, 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+  BOOST_REQUIRE_EQUAL(timeout, 30);
+}
+
+BOOST_AUTO_TEST_CASE(StatementAttributeMaxRows) {
+  ConnectToSW();
+
+  SQLULEN maxRows = -1;
+  SQLRETURN ret = SQLGetStmtAttr(stmt, SQL_ATTR_MAX_ROWS, &maxRows, 0, 0);
+
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+  BOOST_REQUIRE_EQUAL(maxRows, 0);
+
+  ret = SQLSetStmtAttr(stmt, SQL_ATTR_MAX_ROWS,
+                       reinterpret_cast< SQLPOINTER >(1000), 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLGetStmtAttr(stmt, SQL_ATTR_MAX_ROWS, &maxRows, 0, 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+  BOOST_REQUIRE_EQUAL(maxRows, 1000);
+}
+
 BOOST_AUTO_TEST_CASE(StatementAttributeRowArraySize) {
   // Check that statement array size can be set to values other than 1.
   ConnectToSW();
@@ -329,14 +365,22 @@ BOOST_AUTO_TEST_CASE(StatementAttributeRowBindType) {
                        reinterpret_cast< SQLPOINTER >(SQL_BIND_BY_COLUMN), 0);
   ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
 
-  // Attempt to set to unsupported value
+  // Set to the size of a row structure for row-wise binding
+  struct Row {
+    SQLINTEGER value;
+    SQLLEN valueLen;
+  };
   ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROW_BIND_TYPE,
-                       reinterpret_cast< SQLPOINTER >(1UL), 0);
+                       reinterpret_cast< SQLPOINTER >(sizeof(Row)), 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
 
-  BOOST_REQUIRE_EQUAL(ret, SQL_ERROR);
-  CheckSQLStatementDiagnosticError("HYC00");
-  BOOST_REQUIRE_EQUAL("HYC00: Only binding by column is currently supported",
-                      GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+  ret = SQLGetStmtAttr(stmt, SQL_ATTR_ROW_BIND_TYPE, &rowBindType, 0, 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+  BOOST_REQUIRE_EQUAL(rowBindType, sizeof(Row));
+
+  ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROW_BIND_TYPE,
+                       reinterpret_cast< SQLPOINTER >(SQL_BIND_BY_COLUMN), 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
 }
 
 BOOST_AUTO_TEST_CASE(StatementAttributeRowBindOffset) {
@@ -841,6 +885,22 @@ BOOST_AUTO_TEST_CASE(ConnectionSetConnectOption) {
 
   ret = SQLSetConnectOption(dbc, SQL_ROWSET_SIZE, 100);
   ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+
+  ret = SQLSetConnectOption(dbc, SQL_QUERY_TIMEOUT, 10);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+
+  SQLULEN timeout = 0;
+  ret = SQLGetConnectOption(dbc, SQL_QUERY_TIMEOUT, &timeout);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+  BOOST_CHECK_EQUAL(timeout, 10);
+
+  ret = SQLSetConnectOption(dbc, SQL_MAX_ROWS, 20);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+
+  SQLULEN maxRows = 0;
+  ret = SQLGetConnectOption(dbc, SQL_MAX_ROWS, &maxRows);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+  BOOST_CHECK_EQUAL(maxRows, 20);
 }
 
 BOOST_AUTO_TEST_CASE(ConnectionSetConnectOptionUnsupportedValue) {
@@ -896,8 +956,6 @@ BOOST_AUTO_TEST_CASE(ConnectionSetConnectOptionIgnored) {
   ConnectToSW(SQL_OV_ODBC2);
 
   CHECK_SET_IGNORED_OPTION(SQL_NOSCAN, SQL_TRUE);
-  CHECK_SET_IGNORED_OPTION(SQL_QUERY_TIMEOUT, 10);
-  CHECK_SET_IGNORED_OPTION(SQL_MAX_ROWS, 20);
   CHECK_SET_IGNORED_OPTION(SQL_MAX_LENGTH, 20);
   CHECK_SET_IGNORED_OPTION(SQL_KEYSET_SIZE, 100);
   CHECK_SET_IGNORED_OPTION(SQL_ASYNC_ENABLE, SQL_TRUE);
@@ -991,7 +1049,6 @@ BOOST_AUTO_TEST_CASE(ConnectionGetConnectOption) {
 BOOST_AUTO_TEST_CASE(ConnectionGetConnectOptionIgnored) {
   ConnectToSW(SQL_OV_ODBC2);
 
-  CHECK_GET_IGNORED_OPTION(SQL_QUERY_TIMEOUT);
   CHECK_GET_IGNORED_OPTION(SQL_ACCESS_MODE);
   CHECK_GET_IGNORED_OPTION(SQL_TXN_ISOLATION);
   CHECK_GET_IGNORED_OPTION(SQL_CURRENT_QUALIFIER);
@@ -1065,9 +1122,7 @@ BOOST_AUTO_TEST_CASE(StatementOptionNotSupported) {
   CHECK_GET_OPTION_NOTSUPPORTED(SQL_ASYNC_ENABLE);
   CHECK_GET_OPTION_NOTSUPPORTED(SQL_KEYSET_SIZE);
   CHECK_GET_OPTION_NOTSUPPORTED(SQL_MAX_LENGTH);
-  CHECK_GET_OPTION_NOTSUPPORTED(SQL_MAX_ROWS);
   CHECK_GET_OPTION_NOTSUPPORTED(SQL_NOSCAN);
-  CHECK_GET_OPTION_NOTSUPPORTED(SQL_QUERY_TIMEOUT);
   CHECK_GET_OPTION_NOTSUPPORTED(SQL_SIMULATE_CURSOR);
   CHECK_GET_OPTION_NOTSUPPORTED(SQL_USE_BOOKMARKS);
 }
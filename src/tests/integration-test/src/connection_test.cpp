@@ -28,6 +28,8 @@
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/monomorphic.hpp>
+#include <chrono>
+#include <iostream>
 #include <string>
 #include <thread>
 
@@ -1097,6 +1099,31 @@ BOOST_AUTO_TEST_CASE(TestConnectionOnlyDisconnect) {
   Disconnect();
 }
 
+BOOST_AUTO_TEST_CASE(TestConnectionValidationRepetative, *disabled()) {
+  // Measure the connect latency of each connection validation mode
+  const int repeats = 20;
+  const char* modes[] = {"full", "light", "once", "lazy"};
+  for (const char* mode : modes) {
+    std::string connectionString;
+    CreateDsnConnectionStringForAWS(
+        connectionString, "", "",
+        std::string("connectionValidation=") + mode + ";");
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < repeats; i++) {
+      Connect(connectionString);
+      Disconnect();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "Connection validation " << mode << ": "
+              << std::chrono::duration_cast< std::chrono::milliseconds >(
+                     end - start)
+                         .count()
+                     / repeats
+              << " milliseconds per connect\n";
+  }
+}
+
 BOOST_AUTO_TEST_CASE(TestSQLConnectionIncompleteBasicProperties) {
   const std::string dsn = "IncompleteBasicProperties";
   std::string connectionString =
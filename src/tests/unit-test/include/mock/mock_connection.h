@@ -57,7 +57,7 @@ class MockConnection : public Connection {
    * @param cfg connection configuration.
    * @return a shared_ptr to created MockIoTSiteWiseClient object.
    */
-  virtual std::shared_ptr< Aws::IoTSiteWise::IoTSiteWiseClient >
+  virtual std::shared_ptr< QueryClient >
   CreateIoTSiteWiseClient(const Aws::Auth::AWSCredentials& credentials,
                       const Aws::Client::ClientConfiguration& clientCfg);
 
@@ -22,14 +22,15 @@
 #include <aws/iotsitewise/IoTSiteWiseClient.h>
 #include <aws/iotsitewise/model/ExecuteQueryRequest.h>
 
+#include "iotsitewise/odbc/query_client.h"
+
 namespace iotsitewise {
 namespace odbc {
 /**
  * Mock IoT SiteWiseQueryClient so its behavior could be controlled by us.
  * All interfaces should be kept same as IoT SiteWiseQueryClient.
  */
-class MockIoTSiteWiseClient
-    : public Aws::IoTSiteWise::IoTSiteWiseClient {
+class MockIoTSiteWiseClient : public QueryClient {
  public:
   /**
    * Constructor.
@@ -38,8 +39,7 @@ class MockIoTSiteWiseClient
       const Aws::Auth::AWSCredentials &credentials,
       const Aws::Client::ClientConfiguration &clientConfiguration =
           Aws::Client::ClientConfiguration())
-      : Aws::IoTSiteWise::IoTSiteWiseClient(credentials,
-                                                    clientConfiguration),
+      : QueryClient(credentials, clientConfiguration),
         credentials_(credentials),
         clientConfiguration_(clientConfiguration) {
   }
@@ -91,22 +91,53 @@ class MockIoTSiteWiseService {
   Aws::IoTSiteWise::Model::ExecuteQueryOutcome HandleQueryReq(
       const Aws::IoTSiteWise::Model::ExecuteQueryRequest& request);
 
+  /**
+   * Get number of query requests handled
+   *
+   * @return The number of query requests
+   */
+  int GetRequestCount() const {
+    return requestCount_;
+  }
+
+  /**
+   * Get max results of the last query request
+   *
+   * @return The max results, 0 if it is not set
+   */
+  int GetLastMaxResults() const {
+    return lastMaxResults_;
+  }
+
+  /**
+   * Reset the request statistics
+   */
+  void ResetRequestCount() {
+    requestCount_ = 0;
+    lastMaxResults_ = 0;
+  }
+
  private:
   /**
    * Constructor.
    */
-  MockIoTSiteWiseService() {
+  MockIoTSiteWiseService() : requestCount_(0), lastMaxResults_(0) {
   }
 
   void SetupResultForMockTable(
       Aws::IoTSiteWise::Model::ExecuteQueryResult& result);
 
+  void SetupResultForLargePage(
+      Aws::IoTSiteWise::Model::ExecuteQueryResult& result);
+
   static std::mutex mutex_;
   static MockIoTSiteWiseService* instance_;
   std::map< Aws::String, Aws::String >
       credMap_;  // credentials configured by user
   static int token;
   static int errorToken;
+  int requestCount_;    // number of query requests handled
+  int lastMaxResults_;  // max results of the last query request
 };
 }  // namespace odbc
 }  // namespace iotsitewise
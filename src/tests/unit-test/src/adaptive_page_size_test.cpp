@@ -0,0 +1,69 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include <iotsitewise/odbc/adaptive_page_size.h>
+
+#include <boost/test/unit_test.hpp>
+
+using iotsitewise::odbc::AdaptivePageSize;
+using namespace boost::unit_test;
+
+BOOST_AUTO_TEST_SUITE(AdaptivePageSizeTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestAdaptivePageSizeRampUp) {
+  AdaptivePageSize pageSize(100, 1000, 1024 * 1024 * 1024, 2, 1000);
+  BOOST_CHECK_EQUAL(pageSize.GetPageSize(), 100);
+
+  pageSize.Update(100, 100 * 64, 50);
+  BOOST_CHECK_EQUAL(pageSize.GetPageSize(), 200);
+
+  pageSize.Update(200, 200 * 64, 50);
+  pageSize.Update(400, 400 * 64, 50);
+  pageSize.Update(800, 800 * 64, 50);
+  BOOST_CHECK_EQUAL(pageSize.GetPageSize(), 1000);
+
+  // a partial page does not grow the page size
+  AdaptivePageSize partial(100, 1000, 1024 * 1024 * 1024, 2, 1000);
+  partial.Update(40, 40 * 64, 50);
+  BOOST_CHECK_EQUAL(partial.GetPageSize(), 100);
+}
+
+BOOST_AUTO_TEST_CASE(TestAdaptivePageSizeSlowPages) {
+  AdaptivePageSize pageSize(1000, 0, 1024 * 1024 * 1024, 2, 1000);
+
+  // within twice the target latency the page size is kept
+  pageSize.Update(1000, 1000 * 64, 1500);
+  BOOST_CHECK_EQUAL(pageSize.GetPageSize(), 1000);
+
+  pageSize.Update(1000, 1000 * 64, 5000);
+  BOOST_CHECK_EQUAL(pageSize.GetPageSize(), 500);
+}
+
+BOOST_AUTO_TEST_CASE(TestAdaptivePageSizeMemoryBudget) {
+  // 2 pages of 1000 bytes rows within 1 MB
+  AdaptivePageSize pageSize(100, 0, 1024 * 1024, 2, 1000);
+
+  for (int i = 0; i < 10; i++) {
+    pageSize.Update(pageSize.GetPageSize(), pageSize.GetPageSize() * 1000, 10);
+  }
+  BOOST_CHECK_EQUAL(pageSize.GetPageSize(), 524);
+
+  // the first page size is bounded by the max page size
+  AdaptivePageSize bounded(5000, 200, 1024 * 1024, 2, 1000);
+  BOOST_CHECK_EQUAL(bounded.GetPageSize(), 200);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,99 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include <iotsitewise/odbc/async_log_queue.h>
+
+#include <boost/test/unit_test.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+using iotsitewise::odbc::AsyncLogQueue;
+using namespace boost::unit_test;
+
+BOOST_AUTO_TEST_SUITE(AsyncLogQueueTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestAsyncLogQueueFull) {
+  AsyncLogQueue queue(3);
+  // the capacity is rounded up to a power of two
+  BOOST_CHECK_EQUAL(queue.GetCapacity(), 4);
+
+  for (int i = 0; i < 4; i++) {
+    std::string message = "message " + std::to_string(i);
+    BOOST_CHECK(queue.TryPush(message));
+  }
+
+  // a message is left untouched when the queue is full
+  std::string message = "message 4";
+  BOOST_CHECK(!queue.TryPush(message));
+  BOOST_CHECK_EQUAL(message, "message 4");
+
+  std::string popped;
+  BOOST_CHECK(queue.TryPop(popped));
+  BOOST_CHECK_EQUAL(popped, "message 0");
+  BOOST_CHECK(queue.TryPush(message));
+
+  for (int i = 1; i <= 4; i++) {
+    BOOST_CHECK(queue.TryPop(popped));
+    BOOST_CHECK_EQUAL(popped, "message " + std::to_string(i));
+  }
+  BOOST_CHECK(!queue.TryPop(popped));
+}
+
+BOOST_AUTO_TEST_CASE(TestAsyncLogQueueProducers) {
+  const int producers = 4;
+  const int messages = 10000;
+  AsyncLogQueue queue(64);
+
+  std::vector< std::thread > threads;
+  for (int p = 0; p < producers; p++) {
+    threads.emplace_back([&queue, p]() {
+      for (int i = 0; i < messages; i++) {
+        std::string message = std::to_string(p) + ":" + std::to_string(i);
+        while (!queue.TryPush(message)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  // the messages of each producer are popped in the order they are pushed
+  std::vector< int > next(producers, 0);
+  int total = 0;
+  std::string message;
+  while (total < producers * messages) {
+    if (!queue.TryPop(message)) {
+      std::this_thread::yield();
+      continue;
+    }
+    size_t sep = message.find(':');
+    int p = std::stoi(message.substr(0, sep));
+    int i = std::stoi(message.substr(sep + 1));
+    BOOST_REQUIRE_EQUAL(i, next[p]);
+    next[p]++;
+    total++;
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  BOOST_CHECK(!queue.TryPop(message));
+  for (int p = 0; p < producers; p++) {
+    BOOST_CHECK_EQUAL(next[p], messages);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,152 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include <mock/mock_iotsitewise_client.h>
+
+#include <boost/test/unit_test.hpp>
+#include <memory>
+#include <string>
+
+#include "iotsitewise/odbc/client_registry.h"
+
+using iotsitewise::odbc::ClientRegistry;
+using iotsitewise::odbc::MockIoTSiteWiseClient;
+using iotsitewise::odbc::QueryClient;
+using namespace boost::unit_test;
+
+namespace {
+Aws::Auth::AWSCredentials MakeCredentials(const std::string& secret) {
+  return Aws::Auth::AWSCredentials("AKIAEXAMPLE", secret.c_str(), "");
+}
+
+// Factory counting the created clients
+ClientRegistry::Factory MakeFactory(int& created) {
+  return [&created]() {
+    created++;
+    return std::static_pointer_cast< QueryClient >(
+        std::make_shared< MockIoTSiteWiseClient >(MakeCredentials("secret")));
+  };
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ClientRegistryTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestMakeKey) {
+  Aws::Client::ClientConfiguration clientCfg;
+  clientCfg.region = "us-west-2";
+  std::string key = ClientRegistry::MakeKey(MakeCredentials("secret"),
+                                            clientCfg, "", 0, false);
+  BOOST_CHECK_EQUAL(key, ClientRegistry::MakeKey(MakeCredentials("secret"),
+                                                 clientCfg, "", 0, false));
+  BOOST_CHECK(key.find("secret") == std::string::npos);
+
+  // credentials, endpoint and client settings are all compared
+  BOOST_CHECK(key != ClientRegistry::MakeKey(MakeCredentials("other"),
+                                             clientCfg, "", 0, false));
+  BOOST_CHECK(key != ClientRegistry::MakeKey(MakeCredentials("secret"),
+                                             clientCfg, "host", 0, false));
+  BOOST_CHECK(key != ClientRegistry::MakeKey(MakeCredentials("secret"),
+                                             clientCfg, "", 3, false));
+  BOOST_CHECK(key != ClientRegistry::MakeKey(MakeCredentials("secret"),
+                                             clientCfg, "", 0, true));
+  Aws::Client::ClientConfiguration otherCfg = clientCfg;
+  otherCfg.maxConnections = clientCfg.maxConnections + 1;
+  BOOST_CHECK(key != ClientRegistry::MakeKey(MakeCredentials("secret"),
+                                             otherCfg, "", 0, false));
+
+  // the fields are not mistaken for each other when concatenated
+  otherCfg = clientCfg;
+  otherCfg.region = "b";
+  Aws::Client::ClientConfiguration shortCfg = clientCfg;
+  shortCfg.region = "";
+  BOOST_CHECK(ClientRegistry::MakeKey(MakeCredentials("secret"), otherCfg,
+                                      "a", 0, false)
+              != ClientRegistry::MakeKey(MakeCredentials("secret"), shortCfg,
+                                         "ab", 0, false));
+}
+
+BOOST_AUTO_TEST_CASE(TestAcquireSharesClient) {
+  ClientRegistry registry;
+  int created = 0;
+
+  std::shared_ptr< QueryClient > first =
+      registry.Acquire("a", MakeFactory(created));
+  std::shared_ptr< QueryClient > second =
+      registry.Acquire("a", MakeFactory(created));
+  BOOST_REQUIRE(first);
+  BOOST_CHECK_EQUAL(first.get(), second.get());
+  BOOST_CHECK_EQUAL(created, 1);
+
+  std::shared_ptr< QueryClient > other =
+      registry.Acquire("b", MakeFactory(created));
+  BOOST_CHECK(other.get() != first.get());
+  BOOST_CHECK_EQUAL(created, 2);
+  BOOST_CHECK_EQUAL(registry.GetSize(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(TestUnusedClientIsKept) {
+  ClientRegistry registry(60);
+  int created = 0;
+
+  std::shared_ptr< QueryClient > client =
+      registry.Acquire("a", MakeFactory(created));
+  QueryClient* released = client.get();
+  client.reset();
+  BOOST_CHECK_EQUAL(registry.GetSize(), 1);
+
+  // the next connection reuses the client within the idle timeout
+  client = registry.Acquire("a", MakeFactory(created));
+  BOOST_CHECK_EQUAL(client.get(), released);
+  BOOST_CHECK_EQUAL(created, 1);
+}
+
+BOOST_AUTO_TEST_CASE(TestUnusedClientExpires) {
+  ClientRegistry registry(0);
+  int created = 0;
+
+  std::shared_ptr< QueryClient > client =
+      registry.Acquire("a", MakeFactory(created));
+  std::shared_ptr< QueryClient > copy = client;
+  client.reset();
+  // a copy still holds the client
+  BOOST_CHECK_EQUAL(registry.GetSize(), 1);
+
+  copy.reset();
+  BOOST_CHECK_EQUAL(registry.GetSize(), 0);
+
+  client = registry.Acquire("a", MakeFactory(created));
+  BOOST_CHECK(client);
+  BOOST_CHECK_EQUAL(created, 2);
+}
+
+BOOST_AUTO_TEST_CASE(TestClear) {
+  ClientRegistry registry;
+  int created = 0;
+
+  std::shared_ptr< QueryClient > client =
+      registry.Acquire("a", MakeFactory(created));
+  registry.Acquire("b", MakeFactory(created));
+  registry.Clear();
+  BOOST_CHECK_EQUAL(registry.GetSize(), 0);
+
+  // a client held while clearing is no longer shared
+  BOOST_CHECK(registry.Acquire("a", MakeFactory(created)).get()
+              != client.get());
+  client.reset();
+  BOOST_CHECK_EQUAL(registry.GetSize(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,167 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include <boost/test/unit_test.hpp>
+#include <cstring>
+#include <string>
+
+#include "iotsitewise/odbc/conversion_plan.h"
+#include "iotsitewise/odbc/system/odbc_constants.h"
+
+using Aws::IoTSiteWise::Model::ColumnInfo;
+using Aws::IoTSiteWise::Model::ColumnType;
+using Aws::IoTSiteWise::Model::Datum;
+using Aws::IoTSiteWise::Model::ExecuteQueryResult;
+using Aws::IoTSiteWise::Model::Row;
+using Aws::IoTSiteWise::Model::ScalarType;
+using iotsitewise::odbc::ConversionPlan;
+using iotsitewise::odbc::DecodedPage;
+using iotsitewise::odbc::app::ApplicationDataBuffer;
+using iotsitewise::odbc::app::ConversionResult;
+using iotsitewise::odbc::type_traits::OdbcNativeType;
+using namespace boost::unit_test;
+
+namespace {
+ExecuteQueryResult MakeResult() {
+  ExecuteQueryResult result;
+  const ScalarType types[] = {ScalarType::DOUBLE, ScalarType::INT,
+                              ScalarType::BOOLEAN, ScalarType::TIMESTAMP};
+  const char* values[] = {"-35.75", "-12", "true",
+                          "2022-11-09 23:52:51.554000000"};
+  Row row;
+  for (size_t i = 0; i < 4; i++) {
+    ColumnType type;
+    type.SetScalarType(types[i]);
+    ColumnInfo column;
+    column.SetType(type);
+    result.AddColumns(column);
+
+    Datum datum;
+    datum.SetScalarValue(values[i]);
+    row.AddData(datum);
+  }
+  result.AddRows(row);
+
+  Row nullRow;
+  for (size_t i = 0; i < 4; i++) {
+    Datum datum;
+    datum.SetNullValue(true);
+    nullRow.AddData(datum);
+  }
+  result.AddRows(nullRow);
+  return result;
+}
+
+// Put the value with the generic conversion of the buffer
+ConversionResult::Type PutGeneric(const DecodedPage::Column& column,
+                                  size_t rowIdx,
+                                  ApplicationDataBuffer& dataBuf) {
+  if (column.nulls[rowIdx]) {
+    dataBuf.PutNull();
+    return ConversionResult::Type::AI_SUCCESS;
+  }
+  switch (column.type) {
+    case ScalarType::DOUBLE:
+      return dataBuf.PutDouble(column.doubles[rowIdx]);
+    case ScalarType::INT:
+      return dataBuf.PutInt32(column.ints[rowIdx]);
+    case ScalarType::BOOLEAN:
+      return dataBuf.PutInt8(static_cast< int8_t >(column.ints[rowIdx]));
+    default:
+      return dataBuf.PutTimestamp(column.timestamps[rowIdx]);
+  }
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ConversionPlanTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestConvertersMatchBuffer) {
+  DecodedPage page(MakeResult());
+  const OdbcNativeType::Type targets[] = {
+      OdbcNativeType::Type::AI_CHAR,
+      OdbcNativeType::Type::AI_WCHAR,
+      OdbcNativeType::Type::AI_SIGNED_SHORT,
+      OdbcNativeType::Type::AI_UNSIGNED_SHORT,
+      OdbcNativeType::Type::AI_SIGNED_LONG,
+      OdbcNativeType::Type::AI_UNSIGNED_LONG,
+      OdbcNativeType::Type::AI_FLOAT,
+      OdbcNativeType::Type::AI_DOUBLE,
+      OdbcNativeType::Type::AI_BIT,
+      OdbcNativeType::Type::AI_SIGNED_TINYINT,
+      OdbcNativeType::Type::AI_UNSIGNED_TINYINT,
+      OdbcNativeType::Type::AI_SIGNED_BIGINT,
+      OdbcNativeType::Type::AI_UNSIGNED_BIGINT,
+      OdbcNativeType::Type::AI_TTIMESTAMP};
+
+  for (uint32_t columnIdx = 0; columnIdx < 4; columnIdx++) {
+    BOOST_REQUIRE(page.IsDecoded(columnIdx));
+    const DecodedPage::Column& column = page.GetColumn(columnIdx);
+    for (OdbcNativeType::Type target : targets) {
+      for (size_t rowIdx = 0; rowIdx < 2; rowIdx++) {
+        char expected[256];
+        char actual[256];
+        memset(expected, 0, sizeof(expected));
+        memset(actual, 0, sizeof(actual));
+        SqlLen expectedLen = 0;
+        SqlLen actualLen = 0;
+        ApplicationDataBuffer expectedBuf(target, expected, sizeof(expected),
+                                          &expectedLen);
+        ApplicationDataBuffer actualBuf(target, actual, sizeof(actual),
+                                        &actualLen);
+
+        ConversionResult::Type expectedRes =
+            PutGeneric(column, rowIdx, expectedBuf);
+        ConversionResult::Type actualRes = ConversionPlan::Resolve(
+            column.type, target)(column, rowIdx, actualBuf);
+
+        BOOST_CHECK(expectedRes == actualRes);
+        BOOST_CHECK_EQUAL(expectedLen, actualLen);
+        BOOST_CHECK(memcmp(expected, actual, sizeof(expected)) == 0);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestPlanResolvesOnTypeChange) {
+  ConversionPlan plan;
+  ConversionPlan::Converter toDouble = plan.Get(
+      1, ScalarType::DOUBLE, OdbcNativeType::Type::AI_DOUBLE);
+  BOOST_CHECK(toDouble
+              == ConversionPlan::Resolve(ScalarType::DOUBLE,
+                                         OdbcNativeType::Type::AI_DOUBLE));
+  BOOST_CHECK(toDouble
+              == plan.Get(1, ScalarType::DOUBLE,
+                          OdbcNativeType::Type::AI_DOUBLE));
+
+  // the column is bound to a buffer of another type
+  ConversionPlan::Converter toLong = plan.Get(
+      1, ScalarType::DOUBLE, OdbcNativeType::Type::AI_SIGNED_LONG);
+  BOOST_CHECK(toLong != toDouble);
+  BOOST_CHECK(toLong
+              == ConversionPlan::Resolve(
+                  ScalarType::DOUBLE, OdbcNativeType::Type::AI_SIGNED_LONG));
+
+  // strings are not decoded, they are read from the rows
+  DecodedPage page(MakeResult());
+  ApplicationDataBuffer buf(OdbcNativeType::Type::AI_CHAR, nullptr, 0,
+                            nullptr);
+  ConversionPlan::Converter fromString =
+      plan.Get(2, ScalarType::STRING, OdbcNativeType::Type::AI_CHAR);
+  BOOST_CHECK(fromString(page.GetColumn(0), 0, buf)
+              == ConversionResult::Type::AI_UNSUPPORTED_CONVERSION);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,156 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include <boost/test/unit_test.hpp>
+#include <string>
+
+#include "iotsitewise/odbc/decoded_page.h"
+#include "iotsitewise/odbc/system/odbc_constants.h"
+
+using Aws::IoTSiteWise::Model::ColumnInfo;
+using Aws::IoTSiteWise::Model::ColumnType;
+using Aws::IoTSiteWise::Model::Datum;
+using Aws::IoTSiteWise::Model::ExecuteQueryResult;
+using Aws::IoTSiteWise::Model::Row;
+using Aws::IoTSiteWise::Model::ScalarType;
+using iotsitewise::odbc::DecodedPage;
+using iotsitewise::odbc::app::ApplicationDataBuffer;
+using iotsitewise::odbc::app::ConversionResult;
+using iotsitewise::odbc::type_traits::OdbcNativeType;
+using namespace boost::unit_test;
+
+namespace {
+void AddColumn(ExecuteQueryResult& result, ScalarType scalarType) {
+  ColumnType type;
+  type.SetScalarType(scalarType);
+  ColumnInfo column;
+  column.SetType(type);
+  result.AddColumns(column);
+}
+
+Datum MakeDatum(const std::string& value) {
+  Datum datum;
+  datum.SetScalarValue(value);
+  return datum;
+}
+
+Datum MakeNull() {
+  Datum datum;
+  datum.SetNullValue(true);
+  return datum;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(DecodedPageTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestDecodedColumns) {
+  ExecuteQueryResult result;
+  AddColumn(result, ScalarType::DOUBLE);
+  AddColumn(result, ScalarType::INT);
+  AddColumn(result, ScalarType::BOOLEAN);
+  AddColumn(result, ScalarType::TIMESTAMP);
+  AddColumn(result, ScalarType::STRING);
+
+  Row row1;
+  row1.AddData(MakeDatum("35.5"));
+  row1.AddData(MakeDatum("-12"));
+  row1.AddData(MakeDatum("true"));
+  row1.AddData(MakeDatum("2022-11-09 23:52:51.554000000"));
+  row1.AddData(MakeDatum("cpu_usage"));
+  result.AddRows(row1);
+
+  Row row2;
+  row2.AddData(MakeNull());
+  row2.AddData(MakeDatum("7"));
+  row2.AddData(MakeDatum("false"));
+  row2.AddData(MakeNull());
+  row2.AddData(MakeNull());
+  result.AddRows(row2);
+
+  DecodedPage page(result);
+  BOOST_CHECK(page.IsDecoded(0));
+  BOOST_CHECK(page.IsDecoded(1));
+  BOOST_CHECK(page.IsDecoded(2));
+  BOOST_CHECK(page.IsDecoded(3));
+  // strings are read from the rows
+  BOOST_CHECK(!page.IsDecoded(4));
+  BOOST_CHECK(!page.IsDecoded(5));
+  BOOST_CHECK_EQUAL(page.GetRows().size(), 2);
+
+  double number = 0;
+  SqlLen len = 0;
+  ApplicationDataBuffer doubleBuf(OdbcNativeType::Type::AI_DOUBLE,
+                                  &number, sizeof(number), &len);
+  BOOST_CHECK(page.ReadToBuffer(0, 0, doubleBuf)
+              == ConversionResult::Type::AI_SUCCESS);
+  BOOST_CHECK_EQUAL(number, 35.5);
+  BOOST_CHECK(page.ReadToBuffer(1, 0, doubleBuf)
+              == ConversionResult::Type::AI_SUCCESS);
+  BOOST_CHECK_EQUAL(len, SQL_NULL_DATA);
+
+  int32_t integer = 0;
+  ApplicationDataBuffer intBuf(OdbcNativeType::Type::AI_SIGNED_LONG,
+                               &integer, sizeof(integer), &len);
+  page.ReadToBuffer(0, 1, intBuf);
+  BOOST_CHECK_EQUAL(integer, -12);
+  page.ReadToBuffer(1, 1, intBuf);
+  BOOST_CHECK_EQUAL(integer, 7);
+
+  int8_t flag = 0;
+  ApplicationDataBuffer bitBuf(OdbcNativeType::Type::AI_BIT, &flag,
+                               sizeof(flag), &len);
+  page.ReadToBuffer(0, 2, bitBuf);
+  BOOST_CHECK_EQUAL(flag, 1);
+  page.ReadToBuffer(1, 2, bitBuf);
+  BOOST_CHECK_EQUAL(flag, 0);
+
+  SQL_TIMESTAMP_STRUCT timestamp{};
+  ApplicationDataBuffer timestampBuf(OdbcNativeType::Type::AI_TTIMESTAMP,
+                                     &timestamp, sizeof(timestamp), &len);
+  page.ReadToBuffer(0, 3, timestampBuf);
+  BOOST_CHECK_EQUAL(timestamp.year, 2022);
+  BOOST_CHECK_EQUAL(timestamp.month, 11);
+  BOOST_CHECK_EQUAL(timestamp.day, 9);
+  BOOST_CHECK_EQUAL(timestamp.hour, 23);
+  BOOST_CHECK_EQUAL(timestamp.minute, 52);
+  BOOST_CHECK_EQUAL(timestamp.second, 51);
+  BOOST_CHECK_EQUAL(timestamp.fraction, 554000000);
+}
+
+BOOST_AUTO_TEST_CASE(TestUndecodedColumns) {
+  ExecuteQueryResult result;
+  AddColumn(result, ScalarType::DOUBLE);
+  AddColumn(result, ScalarType::INT);
+  AddColumn(result, ScalarType::INT);
+
+  Datum array;
+  array.AddArrayValue(MakeDatum("1"));
+
+  Row row;
+  row.AddData(MakeDatum("abc"));
+  row.AddData(array);
+  row.AddData(MakeDatum("99999999999"));
+  result.AddRows(row);
+
+  DecodedPage page(result);
+  // a value that is not a number, an array value and an int out of range
+  // are read from the rows, the text conversion reports the malformed values
+  BOOST_CHECK(!page.IsDecoded(0));
+  BOOST_CHECK(!page.IsDecoded(1));
+  BOOST_CHECK(!page.IsDecoded(2));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,192 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include <boost/test/unit_test.hpp>
+#include <string>
+
+#include "iotsitewise/odbc/iotsitewise_column.h"
+#include "iotsitewise/odbc/system/odbc_constants.h"
+
+using Aws::IoTSiteWise::Model::ColumnInfo;
+using Aws::IoTSiteWise::Model::ColumnType;
+using Aws::IoTSiteWise::Model::Datum;
+using Aws::IoTSiteWise::Model::Row;
+using Aws::IoTSiteWise::Model::ScalarType;
+using iotsitewise::odbc::IoTSiteWiseColumn;
+using iotsitewise::odbc::app::ApplicationDataBuffer;
+using iotsitewise::odbc::app::ConversionResult;
+using iotsitewise::odbc::meta::ColumnMeta;
+using iotsitewise::odbc::type_traits::OdbcNativeType;
+using namespace boost::unit_test;
+
+namespace {
+ColumnMeta MakeMeta(bool hasScalarType, ScalarType scalarType) {
+  ColumnType type;
+  if (hasScalarType) {
+    type.SetScalarType(scalarType);
+  }
+  ColumnInfo columnInfo;
+  columnInfo.SetName("value");
+  columnInfo.SetType(type);
+
+  ColumnMeta columnMeta;
+  columnMeta.ReadMetadata(columnInfo);
+  return columnMeta;
+}
+
+Datum MakeDatum(const std::string& value) {
+  Datum datum;
+  datum.SetScalarValue(value);
+  return datum;
+}
+
+Datum MakeNull() {
+  Datum datum;
+  datum.SetNullValue(true);
+  return datum;
+}
+
+Datum MakeRow(const std::vector< Datum >& values) {
+  Row row;
+  row.SetData(Aws::Vector< Datum >(values.begin(), values.end()));
+  Datum datum;
+  datum.SetRowValue(row);
+  return datum;
+}
+
+std::string Read(const IoTSiteWiseColumn& column, const Datum& datum,
+                 ConversionResult::Type& res) {
+  std::vector< char > buf(64 * 1024);
+  SqlLen resLen = 0;
+  ApplicationDataBuffer dataBuf(OdbcNativeType::Type::AI_CHAR, buf.data(),
+                                static_cast< SqlLen >(buf.size()), &resLen);
+  res = column.ReadToBuffer(datum, dataBuf);
+  return std::string(buf.data());
+}
+
+std::string Read(const IoTSiteWiseColumn& column, const Datum& datum) {
+  ConversionResult::Type res;
+  std::string value = Read(column, datum, res);
+  BOOST_CHECK(res == ConversionResult::Type::AI_SUCCESS);
+  return value;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(IoTSiteWiseColumnTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestNestedValuesAsText) {
+  ColumnMeta columnMeta = MakeMeta(false, ScalarType::NOT_SET);
+  IoTSiteWiseColumn column(0, columnMeta);
+
+  Datum array;
+  array.AddArrayValue(MakeDatum("a"));
+  array.AddArrayValue(MakeNull());
+  array.AddArrayValue(MakeRow({MakeDatum("1"), MakeDatum("b")}));
+  BOOST_CHECK_EQUAL(Read(column, array), "[a,,(1,b)]");
+
+  Datum emptyArray;
+  emptyArray.SetArrayValue(Aws::Vector< Datum >());
+  BOOST_CHECK_EQUAL(Read(column, emptyArray), "");
+
+  BOOST_CHECK_EQUAL(Read(column, MakeRow({})), "()");
+
+  Datum noDataRow;
+  noDataRow.SetRowValue(Row());
+  ConversionResult::Type res;
+  Read(column, noDataRow, res);
+  BOOST_CHECK(res == ConversionResult::Type::AI_NO_DATA);
+}
+
+BOOST_AUTO_TEST_CASE(TestNestedValuesLargeElement) {
+  ColumnMeta columnMeta = MakeMeta(false, ScalarType::NOT_SET);
+  IoTSiteWiseColumn column(0, columnMeta);
+
+  // elements were cut at 1024 bytes before
+  std::string large(5000, 'x');
+  Datum array;
+  array.AddArrayValue(MakeDatum(large));
+  array.AddArrayValue(MakeDatum("y"));
+  BOOST_CHECK_EQUAL(Read(column, array), "[" + large + ",y]");
+}
+
+BOOST_AUTO_TEST_CASE(TestNestedValuesAsJson) {
+  ColumnMeta stringMeta = MakeMeta(false, ScalarType::NOT_SET);
+  IoTSiteWiseColumn stringColumn(0, stringMeta, true);
+
+  Datum array;
+  array.AddArrayValue(MakeDatum("say \"hi\"\n"));
+  array.AddArrayValue(MakeNull());
+  array.AddArrayValue(MakeRow({MakeDatum("a\\b"), MakeDatum("\x01")}));
+  Datum emptyArray;
+  emptyArray.SetArrayValue(Aws::Vector< Datum >());
+  array.AddArrayValue(emptyArray);
+  BOOST_CHECK_EQUAL(Read(stringColumn, array),
+                    "[\"say \\\"hi\\\"\\n\",null,[\"a\\\\b\",\"\\u0001\"],[]]");
+
+  ColumnMeta doubleMeta = MakeMeta(true, ScalarType::DOUBLE);
+  IoTSiteWiseColumn doubleColumn(0, doubleMeta, true);
+  Datum numbers;
+  numbers.AddArrayValue(MakeDatum("-35.5e2"));
+  numbers.AddArrayValue(MakeDatum("NaN"));
+  numbers.AddArrayValue(MakeDatum("01"));
+  BOOST_CHECK_EQUAL(Read(doubleColumn, numbers), "[-35.5e2,\"NaN\",\"01\"]");
+
+  ColumnMeta booleanMeta = MakeMeta(true, ScalarType::BOOLEAN);
+  IoTSiteWiseColumn booleanColumn(0, booleanMeta, true);
+  Datum flags;
+  flags.AddArrayValue(MakeDatum("true"));
+  flags.AddArrayValue(MakeDatum("false"));
+  BOOST_CHECK_EQUAL(Read(booleanColumn, flags), "[true,false]");
+}
+
+BOOST_AUTO_TEST_CASE(TestNestedValuesInParts) {
+  ColumnMeta columnMeta = MakeMeta(false, ScalarType::NOT_SET);
+  IoTSiteWiseColumn column(0, columnMeta);
+
+  Datum array;
+  for (int i = 0; i < 100; i++) {
+    array.AddArrayValue(MakeDatum(std::to_string(i)));
+  }
+  ConversionResult::Type res;
+  std::string expected = Read(column, array, res);
+  BOOST_REQUIRE(res == ConversionResult::Type::AI_SUCCESS);
+
+  // the length is reported without a buffer
+  SqlLen resLen = 0;
+  ApplicationDataBuffer lenBuf(OdbcNativeType::Type::AI_CHAR, nullptr, 0,
+                               &resLen);
+  column.ReadToBuffer(array, lenBuf);
+  BOOST_CHECK_EQUAL(resLen, static_cast< SqlLen >(expected.size()));
+
+  // read the value in parts as SQLGetData does
+  char buf[16];
+  ApplicationDataBuffer dataBuf(OdbcNativeType::Type::AI_CHAR, buf,
+                                sizeof(buf), &resLen);
+  dataBuf.SetCellOffset(0);
+  std::string actual;
+  while (true) {
+    res = column.ReadToBuffer(array, dataBuf);
+    if (res == ConversionResult::Type::AI_NO_DATA) {
+      break;
+    }
+    BOOST_REQUIRE(res == ConversionResult::Type::AI_SUCCESS
+                  || res == ConversionResult::Type::AI_VARLEN_DATA_TRUNCATED);
+    actual += buf;
+  }
+  BOOST_CHECK_EQUAL(actual, expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -23,6 +23,8 @@
 
 #include <boost/optional.hpp>
 #include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <iostream>
 #include <random>
 #include <string>
 
@@ -463,6 +465,71 @@ BOOST_AUTO_TEST_CASE(TestLogSetInvalidLogPath) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(TestLogIsLevelEnabled) {
+  std::shared_ptr< Logger > logger = Logger::GetLoggerInstance();
+  LogLevel::Type origLogLevel = logger->GetLogLevel();
+
+  logger->SetLogLevel(LogLevel::Type::WARNING_LEVEL);
+  BOOST_CHECK(Logger::IsLevelEnabled(LogLevel::Type::ERROR_LEVEL));
+  BOOST_CHECK(Logger::IsLevelEnabled(LogLevel::Type::WARNING_LEVEL));
+  BOOST_CHECK(!Logger::IsLevelEnabled(LogLevel::Type::INFO_LEVEL));
+  BOOST_CHECK(!Logger::IsLevelEnabled(LogLevel::Type::DEBUG_LEVEL));
+
+  logger->SetLogLevel(LogLevel::Type::DEBUG_LEVEL);
+  BOOST_CHECK(Logger::IsLevelEnabled(LogLevel::Type::DEBUG_LEVEL));
+
+  logger->SetLogLevel(LogLevel::Type::OFF);
+  BOOST_CHECK(!Logger::IsLevelEnabled(LogLevel::Type::ERROR_LEVEL));
+
+  logger->SetLogLevel(origLogLevel);
+}
+
+namespace {
+// Stands for the conversion of a cell, with the log statements of the
+// conversion path
+int64_t ConvertCellWithLog(int64_t value) {
+  LOG_DEBUG_MSG("ConvertCell is called with value " << value);
+  int64_t result = value * 31 + 7;
+  LOG_DEBUG_MSG("result is " << result);
+  return result;
+}
+
+int64_t ConvertCell(int64_t value) {
+  return value * 31 + 7;
+}
+}  // namespace
+
+// Enable test to determine the cost of the log statements of a disabled level.
+BOOST_AUTO_TEST_CASE(TestLogDisabledLevelRepetative, *disabled()) {
+  std::shared_ptr< Logger > logger = Logger::GetLoggerInstance();
+  LogLevel::Type origLogLevel = logger->GetLogLevel();
+  logger->SetLogLevel(LogLevel::Type::WARNING_LEVEL);
+
+  const int64_t cells = 100000000;
+  volatile int64_t sink = 0;
+  auto t1 = std::chrono::high_resolution_clock::now();
+  for (int64_t i = 0; i < cells; i++) {
+    sink = ConvertCellWithLog(i);
+  }
+  auto t2 = std::chrono::high_resolution_clock::now();
+  for (int64_t i = 0; i < cells; i++) {
+    sink = ConvertCell(i);
+  }
+  auto t3 = std::chrono::high_resolution_clock::now();
+  (void)sink;
+
+  std::cout << "With log statements at WARNING level: "
+            << std::chrono::duration_cast< std::chrono::nanoseconds >(t2 - t1)
+                   .count()
+            << " nanoseconds\n";
+  std::cout << "Without log statements: "
+            << std::chrono::duration_cast< std::chrono::nanoseconds >(t3 - t2)
+                   .count()
+            << " nanoseconds\n";
+
+  logger->SetLogLevel(origLogLevel);
+}
+
 BOOST_AUTO_TEST_CASE(TestAWSLogLevelParseMixedCases) {
   using iotsitewise::odbc::Connection;
 
@@ -44,12 +44,10 @@ SqlResult::Type MockConnection::InternalCreateStatement(
   return SqlResult::AI_SUCCESS;
 }
 
-std::shared_ptr< Aws::IoTSiteWise::IoTSiteWiseClient >
-MockConnection::CreateIoTSiteWiseClient(
+std::shared_ptr< QueryClient > MockConnection::CreateIoTSiteWiseClient(
     const Aws::Auth::AWSCredentials& credentials,
     const Aws::Client::ClientConfiguration& clientCfg) {
-  return std::static_pointer_cast<
-      Aws::IoTSiteWise::IoTSiteWiseClient >(
+  return std::static_pointer_cast< QueryClient >(
       std::make_shared< iotsitewise::odbc::MockIoTSiteWiseClient >(
           credentials, clientCfg));
 }
@@ -24,6 +24,10 @@
 
 #include <mock/mock_iotsitewise_service.h>
 
+#include <chrono>
+#include <string>
+#include <thread>
+
 namespace iotsitewise {
 namespace odbc {
 
@@ -116,11 +120,45 @@ void MockIoTSiteWiseService::SetupResultForMockTable(
   result.AddRows(row3);
 }
 
+// Setup ExecuteQueryResult of 10000 rows with a double and a timestamp column
+void MockIoTSiteWiseService::SetupResultForLargePage(
+    Aws::IoTSiteWise::Model::ExecuteQueryResult& result) {
+  Aws::IoTSiteWise::Model::ColumnInfo firstColumn;
+  firstColumn.SetName("value");
+  Aws::IoTSiteWise::Model::ColumnType doubleType;
+  doubleType.SetScalarType(Aws::IoTSiteWise::Model::ScalarType::DOUBLE);
+  firstColumn.SetType(doubleType);
+
+  Aws::IoTSiteWise::Model::ColumnInfo secondColumn;
+  secondColumn.SetName("time");
+  Aws::IoTSiteWise::Model::ColumnType timeType;
+  timeType.SetScalarType(Aws::IoTSiteWise::Model::ScalarType::TIMESTAMP);
+  secondColumn.SetType(timeType);
+  result.AddColumns(firstColumn);
+  result.AddColumns(secondColumn);
+
+  Aws::IoTSiteWise::Model::Datum time;
+  time.SetScalarValue("2022-11-09 23:52:51.554000000");
+  for (int i = 0; i < 10000; i++) {
+    Aws::IoTSiteWise::Model::Datum value;
+    value.SetScalarValue(std::to_string(i) + ".5");
+
+    Aws::IoTSiteWise::Model::Row row;
+    row.AddData(value);
+    row.AddData(time);
+    result.AddRows(row);
+  }
+}
+
 // This function simulates AWS IoT SiteWise service. It provides
 // simple result without the need of parsing the query. Update
 // this function if new query needs to be handled.
 Aws::IoTSiteWise::Model::ExecuteQueryOutcome MockIoTSiteWiseService::HandleQueryReq(
     const Aws::IoTSiteWise::Model::ExecuteQueryRequest& request) {
+  requestCount_++;
+  lastMaxResults_ =
+      request.MaxResultsHasBeenSet() ? request.GetMaxResults() : 0;
+
   if (request.GetQueryStatement() == "SELECT table_name FROM system.tables") {
     // set up ExecuteQueryResult
     Aws::IoTSiteWise::Model::ExecuteQueryResult result;
@@ -145,6 +183,18 @@ Aws::IoTSiteWise::Model::ExecuteQueryOutcome MockIoTSiteWiseService::HandleQuery
     // for pagination test
     result.SetNextToken(std::to_string(++token));
     return Aws::IoTSiteWise::Model::ExecuteQueryOutcome(result);
+  } else if (request.GetQueryStatement()
+             == "select measure, time from mockDB.mockTable3Pages") {
+    Aws::IoTSiteWise::Model::ExecuteQueryResult result;
+    SetupResultForMockTable(result);
+
+    // the first two pages are followed by another page
+    if (request.GetNextToken().empty()) {
+      result.SetNextToken("1");
+    } else if (request.GetNextToken() == "1") {
+      result.SetNextToken("2");
+    }
+    return Aws::IoTSiteWise::Model::ExecuteQueryOutcome(result);
   } else if (request.GetQueryStatement()
              == "select measure, time from mockDB.mockTable10Error") {
     Aws::IoTSiteWise::Model::ExecuteQueryResult result;
@@ -161,6 +211,45 @@ Aws::IoTSiteWise::Model::ExecuteQueryOutcome MockIoTSiteWiseService::HandleQuery
 
       return Aws::IoTSiteWise::Model::ExecuteQueryOutcome(error);
     }
+  } else if (request.GetQueryStatement()
+             == "select value, time from mockDB.mockTableLargePages") {
+    // 10 pages of 10000 rows, the page is built once
+    static Aws::IoTSiteWise::Model::ExecuteQueryResult page = [this]() {
+      Aws::IoTSiteWise::Model::ExecuteQueryResult largePage;
+      SetupResultForLargePage(largePage);
+      return largePage;
+    }();
+    Aws::IoTSiteWise::Model::ExecuteQueryResult result = page;
+
+    int pageIdx = request.GetNextToken().empty()
+                      ? 0
+                      : std::stoi(request.GetNextToken());
+    if (pageIdx < 9) {
+      result.SetNextToken(std::to_string(pageIdx + 1));
+    }
+    return Aws::IoTSiteWise::Model::ExecuteQueryOutcome(result);
+  } else if (request.GetQueryStatement()
+             == "select measure, time from mockDB.mockTableSlow") {
+    if (request.GetNextToken().empty()) {
+      Aws::IoTSiteWise::Model::ExecuteQueryResult result;
+      SetupResultForMockTable(result);
+      result.SetNextToken("1");
+      return Aws::IoTSiteWise::Model::ExecuteQueryOutcome(result);
+    }
+
+    // The following pages never arrive. Like the HTTP client, poll the
+    // continue handler and fail the request once it is aborted.
+    const Aws::Http::ContinueRequestHandler& handler =
+        request.GetContinueRequestHandler();
+    for (int i = 0; i < 1000 && (!handler || handler(nullptr)); i++) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    Aws::IoTSiteWise::IoTSiteWiseError error(
+        Aws::Client::AWSError< Aws::Client::CoreErrors >(
+            Aws::Client::CoreErrors::REQUEST_TIMEOUT, false));
+
+    return Aws::IoTSiteWise::Model::ExecuteQueryOutcome(error);
   } else {
     Aws::IoTSiteWise::IoTSiteWiseError error(
         Aws::Client::AWSError< Aws::Client::CoreErrors >(
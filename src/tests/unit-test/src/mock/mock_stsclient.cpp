@@ -16,6 +16,7 @@
 
 #include <mock/mock_stsclient.h>
 #include <mock/mock_iotsitewise_service.h>
+#include <aws/core/utils/DateTime.h>
 #include <aws/sts/model/AssumeRoleWithSAMLRequest.h>
 
 namespace iotsitewise {
@@ -50,6 +51,11 @@ Model::AssumeRoleWithSAMLOutcome MockSTSClient::AssumeRoleWithSAML(
       credentials.SetSecretAccessKey(credMap.begin()->second);
       credentials.SetSessionToken("");
     }
+    // the credentials of the expiring role are due for a refresh
+    int64_t lifetime =
+        request.GetRoleArn() == "arn:role:expiring" ? 60 : 3600;
+    credentials.SetExpiration(Aws::Utils::DateTime(
+        Aws::Utils::DateTime::Now().Millis() + lifetime * 1000));
 
     result.SetCredentials(credentials);
     Model::AssumeRoleWithSAMLOutcome outcome(result);
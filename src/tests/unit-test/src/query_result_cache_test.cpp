@@ -0,0 +1,93 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include <boost/test/unit_test.hpp>
+#include <string>
+
+#include "iotsitewise/odbc/query_result_cache.h"
+
+using Aws::IoTSiteWise::Model::ExecuteQueryResult;
+using iotsitewise::odbc::QueryResultCache;
+using namespace boost::unit_test;
+
+namespace {
+QueryResultCache::Pages MakePages(const std::string& token) {
+  ExecuteQueryResult result;
+  result.SetNextToken(token);
+  return QueryResultCache::Pages(
+      1, std::make_shared< iotsitewise::odbc::DecodedPage >(result));
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(QueryResultCacheTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestMakeKey) {
+  BOOST_CHECK_EQUAL(QueryResultCache::MakeKey("user", "select  a\nfrom t;"),
+                    QueryResultCache::MakeKey("user", "select a from t"));
+  BOOST_CHECK(QueryResultCache::MakeKey("user", "select a from t")
+              != QueryResultCache::MakeKey("other", "select a from t"));
+}
+
+BOOST_AUTO_TEST_CASE(TestGetAndExpire) {
+  QueryResultCache cache;
+  QueryResultCache::Pages pages;
+
+  BOOST_CHECK(!cache.Get("a", 60, pages));
+
+  cache.Put("a", MakePages("1"), 100, 1000);
+  BOOST_REQUIRE(cache.Get("a", 60, pages));
+  BOOST_REQUIRE_EQUAL(pages.size(), 1);
+  BOOST_CHECK_EQUAL(pages[0]->GetNextToken(), "1");
+
+  // a caller with a shorter TTL finds the result expired
+  BOOST_CHECK(!cache.Get("a", 0, pages));
+  BOOST_CHECK_EQUAL(cache.GetSize(), 0);
+  BOOST_CHECK_EQUAL(cache.GetBytes(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestMemoryCap) {
+  QueryResultCache cache;
+  QueryResultCache::Pages pages;
+
+  cache.Put("a", MakePages("a"), 400, 1000);
+  cache.Put("b", MakePages("b"), 400, 1000);
+  BOOST_CHECK(cache.Get("a", 60, pages));
+
+  // the least recently used result is evicted to make room
+  cache.Put("c", MakePages("c"), 400, 1000);
+  BOOST_CHECK_EQUAL(cache.GetSize(), 2);
+  BOOST_CHECK_EQUAL(cache.GetBytes(), 800);
+  BOOST_CHECK(!cache.Get("b", 60, pages));
+  BOOST_CHECK(cache.Get("a", 60, pages));
+  BOOST_CHECK(cache.Get("c", 60, pages));
+
+  // a result larger than the cap is not cached
+  cache.Put("d", MakePages("d"), 2000, 1000);
+  BOOST_CHECK(!cache.Get("d", 60, pages));
+  BOOST_CHECK_EQUAL(cache.GetSize(), 2);
+
+  // replacing a result releases its previous size
+  cache.Put("a", MakePages("a2"), 100, 1000);
+  BOOST_CHECK_EQUAL(cache.GetBytes(), 500);
+  BOOST_REQUIRE(cache.Get("a", 60, pages));
+  BOOST_CHECK_EQUAL(pages[0]->GetNextToken(), "a2");
+
+  cache.Clear();
+  BOOST_CHECK_EQUAL(cache.GetSize(), 0);
+  BOOST_CHECK_EQUAL(cache.GetBytes(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
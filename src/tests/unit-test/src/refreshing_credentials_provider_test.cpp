@@ -0,0 +1,178 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+#include <aws/core/utils/DateTime.h>
+#include <mock/mock_stsclient.h>
+#include <odbc_unit_test_suite.h>
+
+#include <atomic>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+
+#include "iotsitewise/odbc/authentication/refreshing_credentials_provider.h"
+
+using Aws::Auth::AWSCredentials;
+using Aws::Utils::DateTime;
+using iotsitewise::odbc::IoTSiteWiseSAMLCredentialsProvider;
+using iotsitewise::odbc::MockSTSClient;
+using iotsitewise::odbc::OdbcUnitTestSuite;
+using iotsitewise::odbc::RefreshingCredentialsProvider;
+using iotsitewise::odbc::config::Configuration;
+using namespace boost::unit_test;
+
+namespace {
+// SAML provider asking the mock STS client for the credentials of a role
+class MockSAMLProvider : public IoTSiteWiseSAMLCredentialsProvider {
+ public:
+  explicit MockSAMLProvider(const Configuration& config)
+      : IoTSiteWiseSAMLCredentialsProvider(
+          config, nullptr, std::make_shared< MockSTSClient >()) {
+  }
+
+  std::string GetSAMLAssertion(std::string& /*errInfo*/) override {
+    return "assertion";
+  }
+};
+
+// Fetch the credentials of a role, counting the fetches
+RefreshingCredentialsProvider::Fetcher MakeFetcher(const std::string& roleArn,
+                                                   std::atomic< int >& count) {
+  Configuration config;
+  config.SetRoleArn(roleArn);
+  std::shared_ptr< MockSAMLProvider > provider =
+      std::make_shared< MockSAMLProvider >(config);
+  return [provider, &count](AWSCredentials& credentials,
+                            std::string& errInfo) {
+    count++;
+    return provider->GetAWSCredentials(credentials, errInfo);
+  };
+}
+
+// Credentials expiring in a number of seconds
+AWSCredentials MakeCredentials(int64_t lifetime) {
+  AWSCredentials credentials("AwsSWUnitTestKeyId", "AwsSWUnitTestSecretKey");
+  credentials.SetExpiration(
+      DateTime(DateTime::Now().Millis() + lifetime * 1000));
+  return credentials;
+}
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(RefreshingCredentialsProviderTestSuite,
+                         OdbcUnitTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestNoRenewalOutsideWindow) {
+  std::atomic< int > count(0);
+  AWSCredentials credentials = MakeCredentials(3600);
+  std::shared_ptr< RefreshingCredentialsProvider > provider =
+      std::make_shared< RefreshingCredentialsProvider >(
+          credentials, MakeFetcher("arn:role", count));
+
+  BOOST_CHECK(provider->GetAWSCredentials() == credentials);
+  provider->WaitForRefresh();
+  BOOST_CHECK_EQUAL(count.load(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestRenewalAheadOfExpiry) {
+  std::atomic< int > count(0);
+  AWSCredentials credentials = MakeCredentials(60);
+  std::shared_ptr< RefreshingCredentialsProvider > provider =
+      std::make_shared< RefreshingCredentialsProvider >(
+          credentials, MakeFetcher("arn:role", count));
+
+  // the current credentials are returned while the renewal runs
+  BOOST_CHECK(provider->GetAWSCredentials() == credentials);
+  provider->WaitForRefresh();
+  BOOST_CHECK_EQUAL(count.load(), 1);
+
+  AWSCredentials renewed = provider->GetAWSCredentials();
+  BOOST_CHECK_EQUAL(renewed.GetAWSAccessKeyId(), "AwsSWUnitTestKeyId");
+  BOOST_CHECK(renewed.GetExpiration() - DateTime::Now()
+              > std::chrono::minutes(30));
+  provider->WaitForRefresh();
+  BOOST_CHECK_EQUAL(count.load(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(TestRenewalDoesNotBlock) {
+  std::atomic< int > count(0);
+  std::promise< void > release;
+  std::shared_future< void > released = release.get_future().share();
+  RefreshingCredentialsProvider::Fetcher fetcher =
+      MakeFetcher("arn:role", count);
+  AWSCredentials credentials = MakeCredentials(60);
+  std::shared_ptr< RefreshingCredentialsProvider > provider =
+      std::make_shared< RefreshingCredentialsProvider >(
+          credentials, [fetcher, released](AWSCredentials& renewed,
+                                           std::string& errInfo) {
+            released.wait();
+            return fetcher(renewed, errInfo);
+          });
+
+  // requests are signed with the current credentials during the renewal
+  BOOST_CHECK(provider->GetAWSCredentials() == credentials);
+  BOOST_CHECK(provider->GetAWSCredentials() == credentials);
+  BOOST_CHECK_EQUAL(count.load(), 0);
+
+  release.set_value();
+  provider->WaitForRefresh();
+  BOOST_CHECK_EQUAL(count.load(), 1);
+  BOOST_CHECK(provider->GetAWSCredentials().GetExpiration() - DateTime::Now()
+              > std::chrono::minutes(30));
+}
+
+BOOST_AUTO_TEST_CASE(TestFailedRenewalKeepsCredentials) {
+  std::atomic< int > count(0);
+  AWSCredentials credentials = MakeCredentials(60);
+  std::shared_ptr< RefreshingCredentialsProvider > provider =
+      std::make_shared< RefreshingCredentialsProvider >(
+          credentials, MakeFetcher("arn:role:nocredentials", count));
+
+  BOOST_CHECK(provider->GetAWSCredentials() == credentials);
+  provider->WaitForRefresh();
+  BOOST_CHECK_EQUAL(count.load(), 1);
+
+  // the failed renewal is not retried right away
+  BOOST_CHECK(provider->GetAWSCredentials() == credentials);
+  provider->WaitForRefresh();
+  BOOST_CHECK_EQUAL(count.load(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(TestReleaseDuringRenewal) {
+  std::atomic< int > count(0);
+  std::promise< void > release;
+  std::shared_future< void > released = release.get_future().share();
+  RefreshingCredentialsProvider::Fetcher fetcher =
+      MakeFetcher("arn:role", count);
+  AWSCredentials credentials = MakeCredentials(60);
+  std::shared_ptr< RefreshingCredentialsProvider > provider =
+      std::make_shared< RefreshingCredentialsProvider >(
+          credentials, [fetcher, released](AWSCredentials& renewed,
+                                           std::string& errInfo) {
+            released.wait();
+            return fetcher(renewed, errInfo);
+          });
+  BOOST_CHECK(provider->GetAWSCredentials() == credentials);
+
+  // the last reference is dropped without waiting for the renewal
+  std::weak_ptr< RefreshingCredentialsProvider > weak = provider;
+  provider.reset();
+  release.set_value();
+  RefreshingCredentialsProvider::WaitForRenewals();
+  BOOST_CHECK(weak.expired());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
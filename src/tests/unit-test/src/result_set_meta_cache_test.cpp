@@ -0,0 +1,100 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "iotsitewise/odbc/meta/result_set_meta_cache.h"
+
+using iotsitewise::odbc::meta::ColumnMeta;
+using iotsitewise::odbc::meta::ColumnMetaVector;
+using iotsitewise::odbc::meta::Nullability;
+using iotsitewise::odbc::meta::ResultSetMetaCache;
+using namespace boost::unit_test;
+
+namespace {
+ColumnMetaVector MakeMeta(const std::string& column) {
+  ColumnMetaVector meta;
+  meta.emplace_back("database", "table", column, ScalarType::STRING,
+                    Nullability::NULLABLE);
+  return meta;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ResultSetMetaCacheTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestNormalize) {
+  BOOST_CHECK_EQUAL(
+      ResultSetMetaCache::Normalize("  select  a,\n\tb from t ;  "),
+      "select a, b from t");
+  BOOST_CHECK_EQUAL(
+      ResultSetMetaCache::Normalize("select 'a  b' from \"my  table\""),
+      "select 'a  b' from \"my  table\"");
+}
+
+BOOST_AUTO_TEST_CASE(TestLeastRecentlyUsedEviction) {
+  ResultSetMetaCache cache(2, 0);
+  ColumnMetaVector meta;
+
+  BOOST_CHECK(!cache.Get("select a from t", meta));
+
+  cache.Put("select a from t", MakeMeta("a"));
+  cache.Put("select b from t", MakeMeta("b"));
+
+  // whitespace differences share the entry
+  BOOST_REQUIRE(cache.Get("select  a\nfrom t", meta));
+  BOOST_CHECK_EQUAL(meta.size(), 1u);
+  BOOST_CHECK_EQUAL(meta[0].GetColumnName().get_value_or(""), "a");
+
+  // "select b from t" is the least recently used entry
+  cache.Put("select c from t", MakeMeta("c"));
+  BOOST_CHECK_EQUAL(cache.GetSize(), 2u);
+  BOOST_CHECK(!cache.Get("select b from t", meta));
+  BOOST_CHECK(cache.Get("select a from t", meta));
+  BOOST_CHECK(cache.Get("select c from t", meta));
+
+  BOOST_CHECK_EQUAL(cache.GetHits(), 3u);
+  BOOST_CHECK_EQUAL(cache.GetMisses(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(TestExpiration) {
+  ResultSetMetaCache cache(10, 1);
+  ColumnMetaVector meta;
+
+  cache.Put("select a from t", MakeMeta("a"));
+  BOOST_CHECK(cache.Get("select a from t", meta));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+  BOOST_CHECK(!cache.Get("select a from t", meta));
+  BOOST_CHECK_EQUAL(cache.GetSize(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(TestDisabled) {
+  ResultSetMetaCache cache(0, 0);
+  ColumnMetaVector meta;
+
+  cache.Put("select a from t", MakeMeta("a"));
+  BOOST_CHECK(!cache.Get("select a from t", meta));
+  BOOST_CHECK_EQUAL(cache.GetSize(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
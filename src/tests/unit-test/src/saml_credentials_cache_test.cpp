@@ -0,0 +1,133 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+#include <mock/mock_stsclient.h>
+#include <odbc_unit_test_suite.h>
+
+#include <atomic>
+#include <boost/test/unit_test.hpp>
+#include <memory>
+#include <string>
+
+#include "iotsitewise/odbc/authentication/saml_credentials_cache.h"
+
+using iotsitewise::odbc::AuthType;
+using iotsitewise::odbc::IoTSiteWiseSAMLCredentialsProvider;
+using iotsitewise::odbc::MockSTSClient;
+using iotsitewise::odbc::OdbcUnitTestSuite;
+using iotsitewise::odbc::SAMLCredentialsCache;
+using iotsitewise::odbc::config::Configuration;
+using namespace boost::unit_test;
+
+namespace {
+// Provider counting the SAML assertions requested from the IdP
+class CountingProvider : public IoTSiteWiseSAMLCredentialsProvider {
+ public:
+  explicit CountingProvider(const Configuration& config)
+      : IoTSiteWiseSAMLCredentialsProvider(
+          config, nullptr, std::make_shared< MockSTSClient >()),
+        requests(0) {
+  }
+
+  std::string GetSAMLAssertion(std::string& /*errInfo*/) override {
+    requests++;
+    return "assertion";
+  }
+
+  std::atomic< int > requests;
+};
+
+Configuration MakeConfig(const std::string& roleArn) {
+  Configuration config;
+  config.SetAuthType(AuthType::Type::OKTA);
+  config.SetIdPHost("okta-host");
+  config.SetIdPUserName("okta-user");
+  config.SetIdPPassword("okta-password");
+  config.SetRoleArn(roleArn);
+  config.SetIdPArn("arn:idp");
+  return config;
+}
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(SAMLCredentialsCacheTestSuite, OdbcUnitTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestGetCachedCredentials) {
+  SAMLCredentialsCache cache;
+  Configuration config = MakeConfig("arn:role");
+  std::shared_ptr< CountingProvider > provider =
+      std::make_shared< CountingProvider >(config);
+  Aws::Auth::AWSCredentials credentials;
+  std::string errInfo;
+
+  std::string key = SAMLCredentialsCache::MakeKey(config);
+  BOOST_CHECK(key.find("okta-password") == std::string::npos);
+  BOOST_REQUIRE(cache.GetCredentials(key, provider, credentials, errInfo));
+  BOOST_CHECK_EQUAL(credentials.GetAWSAccessKeyId(), "AwsSWUnitTestKeyId");
+  BOOST_REQUIRE(cache.GetCredentials(key, provider, credentials, errInfo));
+  BOOST_CHECK_EQUAL(credentials.GetAWSAccessKeyId(), "AwsSWUnitTestKeyId");
+  BOOST_CHECK_EQUAL(provider->requests.load(), 1);
+  BOOST_CHECK_EQUAL(cache.GetSize(), 1);
+
+  // another user gets its own credentials
+  config.SetIdPUserName("other-user");
+  std::string otherKey = SAMLCredentialsCache::MakeKey(config);
+  BOOST_CHECK(otherKey != key);
+  BOOST_REQUIRE(cache.GetCredentials(otherKey, provider, credentials, errInfo));
+  BOOST_CHECK_EQUAL(provider->requests.load(), 2);
+  BOOST_CHECK_EQUAL(cache.GetSize(), 2);
+
+  cache.Clear();
+  BOOST_CHECK_EQUAL(cache.GetSize(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestRefreshBeforeExpiry) {
+  SAMLCredentialsCache cache;
+  Configuration config = MakeConfig("arn:role:expiring");
+  std::shared_ptr< CountingProvider > provider =
+      std::make_shared< CountingProvider >(config);
+  Aws::Auth::AWSCredentials credentials;
+  std::string errInfo;
+
+  std::string key = SAMLCredentialsCache::MakeKey(config);
+  BOOST_REQUIRE(cache.GetCredentials(key, provider, credentials, errInfo));
+  BOOST_CHECK_EQUAL(provider->requests.load(), 1);
+
+  // the credentials expire within the refresh window, they are returned and
+  // refreshed in the background
+  BOOST_REQUIRE(cache.GetCredentials(key, provider, credentials, errInfo));
+  BOOST_CHECK(!credentials.IsExpiredOrEmpty());
+  cache.WaitForRefreshes();
+  BOOST_CHECK_EQUAL(provider->requests.load(), 2);
+  // the refresh does not keep the provider once it is finished
+  BOOST_CHECK_EQUAL(provider.use_count(), 1);
+  BOOST_CHECK_EQUAL(cache.GetSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(TestFailureNotCached) {
+  SAMLCredentialsCache cache;
+  Configuration config = MakeConfig("arn:role:nocredentials");
+  std::shared_ptr< CountingProvider > provider =
+      std::make_shared< CountingProvider >(config);
+  Aws::Auth::AWSCredentials credentials;
+  std::string errInfo;
+
+  std::string key = SAMLCredentialsCache::MakeKey(config);
+  BOOST_CHECK(!cache.GetCredentials(key, provider, credentials, errInfo));
+  BOOST_CHECK(!cache.GetCredentials(key, provider, credentials, errInfo));
+  BOOST_CHECK_EQUAL(provider->requests.load(), 2);
+  BOOST_CHECK_EQUAL(cache.GetSize(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,81 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include <iotsitewise/odbc/thread_pool.h>
+
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <future>
+#include <string>
+#include <vector>
+
+using iotsitewise::odbc::ThreadPool;
+using namespace boost::unit_test;
+
+BOOST_AUTO_TEST_SUITE(ThreadPoolTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestThreadPoolRunsAllTasks) {
+  std::atomic< int > counter(0);
+  {
+    ThreadPool pool(4);
+    for (int i = 0; i < 1000; i++) {
+      pool.Submit(&pool, [&counter]() { counter++; });
+    }
+    // the destructor waits for the queued tasks to finish
+  }
+  BOOST_CHECK_EQUAL(counter.load(), 1000);
+}
+
+BOOST_AUTO_TEST_CASE(TestThreadPoolOwnerFairness) {
+  int ownerA = 0;
+  int ownerB = 0;
+  std::vector< std::string > order;
+  std::promise< void > started;
+  std::promise< void > release;
+  std::shared_future< void > released = release.get_future().share();
+
+  {
+    ThreadPool pool(1);
+    pool.Submit(&ownerA, [&]() {
+      order.push_back("A1");
+      started.set_value();
+      released.wait();
+    });
+    started.get_future().wait();
+
+    for (int i = 2; i <= 5; i++) {
+      pool.Submit(&ownerA, [&order, i]() {
+        order.push_back("A" + std::to_string(i));
+      });
+    }
+    pool.Submit(&ownerB, [&order]() { order.push_back("B1"); });
+    release.set_value();
+  }
+
+  // the task of ownerB is not queued behind all tasks of ownerA
+  std::vector< std::string > expected = {"A1", "A2", "B1", "A3", "A4", "A5"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expected.begin(),
+                                expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(TestThreadPoolSharedInstance) {
+  std::shared_ptr< ThreadPool > pool = ThreadPool::GetInstance();
+  BOOST_REQUIRE(pool);
+  BOOST_CHECK(pool->GetSize() > 0);
+  BOOST_CHECK_EQUAL(pool.get(), ThreadPool::GetInstance().get());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
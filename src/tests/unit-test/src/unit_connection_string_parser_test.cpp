@@ -212,4 +212,310 @@ BOOST_AUTO_TEST_CASE(TestParsingMaxConnections) {
       "default value. [key='MaxConnections', value='-1000']");
 }
 
+BOOST_AUTO_TEST_CASE(TestParsingPrefetchPages) {
+  iotsitewise::odbc::config::Configuration cfg;
+
+  ConnectionStringParser parser(cfg);
+
+  diagnostic::DiagnosticRecordStorage diag;
+
+  std::string connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "PrefetchPages=4;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 0);
+  BOOST_CHECK_EQUAL(cfg.GetPrefetchPages(), 4);
+
+  connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "PrefetchPages=0;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 1);
+  BOOST_CHECK_EQUAL(diag.GetStatusRecord(1).GetMessageText(),
+                    "Prefetch Pages attribute value is out of range. Using "
+                    "default value. [key='PrefetchPages', value='0']");
+
+  connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "PrefetchPages=-2;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 2);
+  BOOST_CHECK_EQUAL(
+      diag.GetStatusRecord(2).GetMessageText(),
+      "Prefetch Pages attribute value contains unexpected characters. Using "
+      "default value. [key='PrefetchPages', value='-2']");
+}
+
+BOOST_AUTO_TEST_CASE(TestParsingMetadataCache) {
+  iotsitewise::odbc::config::Configuration cfg;
+
+  ConnectionStringParser parser(cfg);
+
+  diagnostic::DiagnosticRecordStorage diag;
+
+  BOOST_CHECK_EQUAL(cfg.GetMetadataCacheSize(), DEFAULT_METADATA_CACHE_SIZE);
+  BOOST_CHECK_EQUAL(cfg.GetMetadataCacheTTL(), DEFAULT_METADATA_CACHE_TTL);
+
+  std::string connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "MetadataCacheSize=0;"
+      "MetadataCacheTTL=60;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 0);
+  BOOST_CHECK_EQUAL(cfg.GetMetadataCacheSize(), 0);
+  BOOST_CHECK_EQUAL(cfg.GetMetadataCacheTTL(), 60);
+
+  connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "MetadataCacheTTL=1m;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 1);
+  BOOST_CHECK_EQUAL(
+      diag.GetStatusRecord(1).GetMessageText(),
+      "Metadata Cache TTL attribute value contains unexpected characters. "
+      "Using default value. [key='MetadataCacheTTL', value='1m']");
+}
+
+BOOST_AUTO_TEST_CASE(TestParsingAdaptivePageSize) {
+  iotsitewise::odbc::config::Configuration cfg;
+
+  ConnectionStringParser parser(cfg);
+
+  diagnostic::DiagnosticRecordStorage diag;
+
+  BOOST_CHECK_EQUAL(cfg.GetFirstPageSize(), DEFAULT_FIRST_PAGE_SIZE);
+  BOOST_CHECK_EQUAL(cfg.GetPageMemoryBudget(), DEFAULT_PAGE_MEMORY_BUDGET);
+
+  std::string connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "FirstPageSize=100;"
+      "PageMemoryBudget=16;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 0);
+  BOOST_CHECK_EQUAL(cfg.GetFirstPageSize(), 100);
+  BOOST_CHECK_EQUAL(cfg.GetPageMemoryBudget(), 16);
+
+  connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "PageMemoryBudget=0;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 1);
+  BOOST_CHECK_EQUAL(
+      diag.GetStatusRecord(1).GetMessageText(),
+      "Page memory budget attribute value is out of range. Using default "
+      "value. [key='PageMemoryBudget', value='0']");
+}
+
+BOOST_AUTO_TEST_CASE(TestParsingResultCache) {
+  iotsitewise::odbc::config::Configuration cfg;
+
+  ConnectionStringParser parser(cfg);
+
+  diagnostic::DiagnosticRecordStorage diag;
+
+  BOOST_CHECK_EQUAL(cfg.GetResultCacheTTL(), DEFAULT_RESULT_CACHE_TTL);
+  BOOST_CHECK_EQUAL(cfg.GetResultCacheSize(), DEFAULT_RESULT_CACHE_SIZE);
+
+  std::string connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "ResultCacheTTL=120;"
+      "ResultCacheSize=256;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 0);
+  BOOST_CHECK_EQUAL(cfg.GetResultCacheTTL(), 120);
+  BOOST_CHECK_EQUAL(cfg.GetResultCacheSize(), 256);
+}
+
+BOOST_AUTO_TEST_CASE(TestParsingQueryCoalescing) {
+  iotsitewise::odbc::config::Configuration cfg;
+
+  ConnectionStringParser parser(cfg);
+
+  diagnostic::DiagnosticRecordStorage diag;
+
+  BOOST_CHECK_EQUAL(cfg.GetQueryCoalescing(), DEFAULT_QUERY_COALESCING);
+
+  std::string connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "QueryCoalescing=TRUE;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 0);
+  BOOST_CHECK(cfg.GetQueryCoalescing());
+
+  // an unrecognized value keeps the current value
+  parser.ParseConnectionString("QueryCoalescing=yes;", &diag);
+  BOOST_CHECK_EQUAL(diag.GetStatusRecordsNumber(), 1);
+  BOOST_CHECK(cfg.GetQueryCoalescing());
+}
+
+BOOST_AUTO_TEST_CASE(TestParsingNestedValuesAsJson) {
+  iotsitewise::odbc::config::Configuration cfg;
+
+  ConnectionStringParser parser(cfg);
+
+  diagnostic::DiagnosticRecordStorage diag;
+
+  BOOST_CHECK_EQUAL(cfg.GetNestedValuesAsJson(),
+                    DEFAULT_NESTED_VALUES_AS_JSON);
+
+  std::string connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "NestedValuesAsJson=true;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 0);
+  BOOST_CHECK(cfg.GetNestedValuesAsJson());
+}
+
+BOOST_AUTO_TEST_CASE(TestParsingLogAsync) {
+  iotsitewise::odbc::config::Configuration cfg;
+
+  ConnectionStringParser parser(cfg);
+
+  diagnostic::DiagnosticRecordStorage diag;
+
+  BOOST_CHECK_EQUAL(cfg.GetLogAsync(), DEFAULT_LOG_ASYNC);
+  BOOST_CHECK_EQUAL(cfg.GetLogQueueSize(), DEFAULT_LOG_QUEUE_SIZE);
+  BOOST_CHECK_EQUAL(cfg.GetLogDropWhenFull(), DEFAULT_LOG_DROP_WHEN_FULL);
+
+  std::string connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "LogAsync=true;"
+      "LogQueueSize=1024;"
+      "LogDropWhenFull=true;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 0);
+  BOOST_CHECK(cfg.GetLogAsync());
+  BOOST_CHECK_EQUAL(cfg.GetLogQueueSize(), 1024);
+  BOOST_CHECK(cfg.GetLogDropWhenFull());
+
+  connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "LogQueueSize=0;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 1);
+  BOOST_CHECK_EQUAL(
+      diag.GetStatusRecord(1).GetMessageText(),
+      "Log Queue Size attribute value is out of range. Using default "
+      "value. [key='LogQueueSize', value='0']");
+}
+
+BOOST_AUTO_TEST_CASE(TestParsingRawResponseDecoding) {
+  iotsitewise::odbc::config::Configuration cfg;
+
+  ConnectionStringParser parser(cfg);
+
+  diagnostic::DiagnosticRecordStorage diag;
+
+  BOOST_CHECK_EQUAL(cfg.GetRawResponseDecoding(),
+                    DEFAULT_RAW_RESPONSE_DECODING);
+
+  std::string connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "RawResponseDecoding=true;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 0);
+  BOOST_CHECK(cfg.GetRawResponseDecoding());
+
+  connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "RawResponseDecoding=maybe;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 1);
+  BOOST_CHECK_EQUAL(
+      diag.GetStatusRecord(1).GetMessageText(),
+      "Raw Response Decoding attribute value is not a boolean. Using default "
+      "value. [key='RawResponseDecoding', value='maybe']");
+}
+
+BOOST_AUTO_TEST_CASE(TestParsingConnectionValidation) {
+  iotsitewise::odbc::config::Configuration cfg;
+
+  ConnectionStringParser parser(cfg);
+
+  diagnostic::DiagnosticRecordStorage diag;
+
+  BOOST_CHECK(cfg.GetConnectionValidation() == DEFAULT_CONNECTION_VALIDATION);
+
+  std::string connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "ConnectionValidation=Once;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 0);
+  BOOST_CHECK(cfg.GetConnectionValidation()
+              == iotsitewise::odbc::ValidationMode::Type::ONCE);
+
+  connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "ConnectionValidation=never;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 1);
+  BOOST_CHECK_EQUAL(diag.GetStatusRecord(1).GetMessageText(),
+                    "Specified Connection Validation is not supported. "
+                    "Default value used ('full').");
+}
+
+BOOST_AUTO_TEST_CASE(TestParsingSAMLCredentialsCache) {
+  iotsitewise::odbc::config::Configuration cfg;
+
+  ConnectionStringParser parser(cfg);
+
+  diagnostic::DiagnosticRecordStorage diag;
+
+  BOOST_CHECK_EQUAL(cfg.GetSAMLCredentialsCache(),
+                    DEFAULT_SAML_CREDENTIALS_CACHE);
+
+  std::string connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "SAMLCredentialsCache=true;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 0);
+  BOOST_CHECK(cfg.GetSAMLCredentialsCache());
+
+  connectionString =
+      "driver={AWS IoT SiteWise ODBC Driver};"
+      "SAMLCredentialsCache=maybe;";
+
+  BOOST_CHECK_NO_THROW(parser.ParseConnectionString(connectionString, &diag));
+
+  BOOST_CHECK(diag.GetStatusRecordsNumber() == 1);
+  BOOST_CHECK_EQUAL(
+      diag.GetStatusRecord(1).GetMessageText(),
+      "SAML Credentials Cache attribute value is not a boolean. Using default "
+      "value. [key='SAMLCredentialsCache', value='maybe']");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
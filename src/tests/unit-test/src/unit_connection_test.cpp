@@ -30,6 +30,7 @@ using iotsitewise::odbc::AuthType;
 using iotsitewise::odbc::MockConnection;
 using iotsitewise::odbc::MockIoTSiteWiseService;
 using iotsitewise::odbc::OdbcUnitTestSuite;
+using iotsitewise::odbc::ValidationMode;
 using iotsitewise::odbc::config::Configuration;
 using namespace boost::unit_test;
 
@@ -198,6 +199,86 @@ BOOST_AUTO_TEST_CASE(TestRelease) {
   BOOST_CHECK_EQUAL(GetSqlState(), "08003");
 }
 
+BOOST_AUTO_TEST_CASE(TestEstablishLightValidation) {
+  Configuration cfg;
+  cfg.SetAuthType(AuthType::Type::IAM);
+  cfg.SetAccessKeyId("AwsSWUnitTestKeyId");
+  cfg.SetSecretKey("AwsSWUnitTestSecretKey");
+  cfg.SetConnectionValidation(ValidationMode::Type::LIGHT);
+  getLogOptions(cfg);
+
+  MockIoTSiteWiseService::GetInstance()->ResetRequestCount();
+  dbc->Establish(cfg);
+
+  BOOST_CHECK(IsSuccessful());
+  // the probe query fetches a single row
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetRequestCount(),
+                    1);
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetLastMaxResults(),
+                    1);
+}
+
+BOOST_AUTO_TEST_CASE(TestEstablishOnceValidation) {
+  Configuration cfg;
+  cfg.SetAuthType(AuthType::Type::IAM);
+  cfg.SetAccessKeyId("AwsSWUnitTestKeyId");
+  cfg.SetSecretKey("AwsSWUnitTestSecretKey");
+  cfg.SetConnectionValidation(ValidationMode::Type::ONCE);
+  getLogOptions(cfg);
+
+  MockIoTSiteWiseService::GetInstance()->ResetRequestCount();
+  dbc->Establish(cfg);
+  BOOST_CHECK(IsSuccessful());
+  dbc->Release();
+
+  // the credentials are not probed again by the next connect
+  dbc->Establish(cfg);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetRequestCount(),
+                    1);
+}
+
+BOOST_AUTO_TEST_CASE(TestEstablishLazyValidation) {
+  Configuration cfg;
+  cfg.SetAuthType(AuthType::Type::IAM);
+  cfg.SetAccessKeyId("AwsSWUnitTestKeyId");
+  cfg.SetSecretKey("InvalidSecretKey");
+  cfg.SetConnectionValidation(ValidationMode::Type::LAZY);
+  getLogOptions(cfg);
+
+  MockIoTSiteWiseService::GetInstance()->ResetRequestCount();
+  dbc->Establish(cfg);
+
+  // invalid credentials are reported by the first statement instead
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetRequestCount(),
+                    0);
+}
+
+BOOST_AUTO_TEST_CASE(TestCredentialsDigest) {
+  Configuration cfg;
+  cfg.SetAuthType(AuthType::Type::IAM);
+  cfg.SetAccessKeyId("AwsSWUnitTestKeyId");
+  cfg.SetSecretKey("AwsSWUnitTestSecretKey");
+  getLogOptions(cfg);
+
+  dbc->Establish(cfg);
+  BOOST_CHECK(IsSuccessful());
+  std::string identity = dbc->GetCredentialsIdentity();
+  std::string digest = dbc->GetCredentialsDigest();
+  BOOST_CHECK(digest.find("AwsSWUnitTestSecretKey") == std::string::npos);
+  dbc->Release();
+
+  // a connection with a wrong secret key has the same identity but does
+  // not share the cached results
+  cfg.SetSecretKey("InvalidSecretKey");
+  cfg.SetConnectionValidation(ValidationMode::Type::LAZY);
+  dbc->Establish(cfg);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(dbc->GetCredentialsIdentity(), identity);
+  BOOST_CHECK(dbc->GetCredentialsDigest() != digest);
+}
+
 BOOST_AUTO_TEST_CASE(TestDeregister) {
   // This will remove dbc from env, any test that
   // needs env should be put ahead of this testcase
@@ -14,20 +14,27 @@
  *
  */
 
+#include <chrono>
+#include <cstring>
+#include <iostream>
 #include <string>
+#include <vector>
 
 #include <odbc_unit_test_suite.h>
 #include "iotsitewise/odbc/log.h"
 #include "iotsitewise/odbc/log_level.h"
+#include "iotsitewise/odbc/query_result_cache.h"
 #include <ignite/common/include/common/platform_utils.h>
 #include <iotsitewise/odbc/authentication/auth_type.h>
 #include "iotsitewise/odbc/statement.h"
+#include "iotsitewise/odbc/system/odbc_constants.h"
 #include "iotsitewise/odbc/utility.h"
 
 using iotsitewise::odbc::AuthType;
 using iotsitewise::odbc::MockConnection;
 using iotsitewise::odbc::MockIoTSiteWiseService;
 using iotsitewise::odbc::OdbcUnitTestSuite;
+using iotsitewise::odbc::QueryResultCache;
 using iotsitewise::odbc::Statement;
 using iotsitewise::odbc::config::Configuration;
 using namespace boost::unit_test;
@@ -82,6 +89,10 @@ struct DataQueryUnitTestSuiteFixture : OdbcUnitTestSuite {
 
   void Connect() {
     Configuration cfg;
+    Connect(cfg);
+  }
+
+  void Connect(Configuration& cfg) {
     cfg.SetAuthType(AuthType::Type::IAM);
     cfg.SetAccessKeyId("AwsSWUnitTestKeyId");
     cfg.SetSecretKey("AwsSWUnitTestSecretKey");
@@ -151,6 +162,337 @@ BOOST_AUTO_TEST_CASE(TestDataQuery10000Rows) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(TestDataQueryPrefetchPages) {
+  // Test fetching 10000 rows with several pages fetched ahead of the cursor
+  Connect();
+
+  SQLULEN prefetchPages = 0;
+  stmt->GetAttribute(SQL_ATTR_SWPREFETCH_PAGES, &prefetchPages, 0, nullptr);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(prefetchPages,
+                    static_cast< SQLULEN >(DEFAULT_PREFETCH_PAGES));
+
+  stmt->SetAttribute(SQL_ATTR_SWPREFETCH_PAGES,
+                     reinterpret_cast< SQLPOINTER >(0), 0);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HY024");
+
+  // the attribute set after the prepare applies to the execution
+  std::string sql = "select measure, time from mockDB.mockTable10000";
+  stmt->PrepareSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  stmt->SetAttribute(SQL_ATTR_SWPREFETCH_PAGES,
+                     reinterpret_cast< SQLPOINTER >(8), 0);
+  BOOST_CHECK(IsSuccessful());
+
+  stmt->GetAttribute(SQL_ATTR_SWPREFETCH_PAGES, &prefetchPages, 0, nullptr);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(prefetchPages, static_cast< SQLULEN >(8));
+
+  stmt->ExecuteSqlQuery();
+
+  BOOST_CHECK(IsSuccessful());
+
+  for (int i = 0; i < 10000; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+  }
+
+  // closing the cursor stops the fetching thread waiting on a full queue
+  stmt->Close();
+  BOOST_CHECK(IsSuccessful());
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryMaxRows) {
+  // Test no more pages are fetched once the row limit is reached
+  Connect();
+  MockIoTSiteWiseService::GetInstance()->ResetRequestCount();
+
+  stmt->SetAttribute(SQL_ATTR_SWPREFETCH_PAGES,
+                     reinterpret_cast< SQLPOINTER >(8), 0);
+  BOOST_CHECK(IsSuccessful());
+  stmt->SetAttribute(SQL_ATTR_MAX_ROWS, reinterpret_cast< SQLPOINTER >(5), 0);
+  BOOST_CHECK(IsSuccessful());
+
+  SQLULEN maxRows = 0;
+  stmt->GetAttribute(SQL_ATTR_MAX_ROWS, &maxRows, 0, nullptr);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(maxRows, static_cast< SQLULEN >(5));
+
+  std::string sql = "select measure, time from mockDB.mockTable10000";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  for (int i = 0; i < 5; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+  }
+  stmt->FetchRow();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+
+  stmt->Close();
+  BOOST_CHECK(IsSuccessful());
+
+  // the second page only asks for the 2 rows left
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetRequestCount(),
+                    2);
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetLastMaxResults(),
+                    2);
+
+  // the limit is reached by the first page
+  MockIoTSiteWiseService::GetInstance()->ResetRequestCount();
+  stmt->SetAttribute(SQL_ATTR_MAX_ROWS, reinterpret_cast< SQLPOINTER >(2), 0);
+  BOOST_CHECK(IsSuccessful());
+
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  for (int i = 0; i < 2; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+  }
+  stmt->FetchRow();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+
+  stmt->Close();
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetRequestCount(),
+                    1);
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetLastMaxResults(),
+                    2);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryAdaptivePageSize) {
+  // Test the page size grows after a small first page
+  Connect();
+  MockIoTSiteWiseService::GetInstance()->ResetRequestCount();
+
+  SQLULEN firstPageSize = 1;
+  stmt->GetAttribute(SQL_ATTR_SWFIRST_PAGE_SIZE, &firstPageSize, 0, nullptr);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(firstPageSize,
+                    static_cast< SQLULEN >(DEFAULT_FIRST_PAGE_SIZE));
+
+  stmt->SetAttribute(SQL_ATTR_SWFIRST_PAGE_SIZE,
+                     reinterpret_cast< SQLPOINTER >(2), 0);
+  BOOST_CHECK(IsSuccessful());
+
+  std::string sql = "select measure, time from mockDB.mockTable10000";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetLastMaxResults(),
+                    2);
+
+  for (int i = 0; i < 30; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+  }
+
+  stmt->Close();
+  BOOST_CHECK(IsSuccessful());
+
+  // the full first page doubles the page size, the following pages of 3
+  // rows are not full and keep it
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetLastMaxResults(),
+                    4);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryDescribeBeforeExecute) {
+  // Test the execution following a describe reuses the described page
+  Connect();
+  MockIoTSiteWiseService::GetInstance()->ResetRequestCount();
+
+  std::string sql = "select measure, time from mockDB.mockTable";
+  stmt->PrepareSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  BOOST_CHECK_EQUAL(stmt->GetColumnNumber(), 2);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetRequestCount(),
+                    1);
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetLastMaxResults(),
+                    1);
+
+  stmt->ExecuteSqlQuery();
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetRequestCount(),
+                    1);
+
+  for (int i = 0; i < 3; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+  }
+  stmt->FetchRow();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+
+  // executing again runs the query again
+  stmt->ExecuteSqlQuery();
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetRequestCount(),
+                    2);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryMetadataCache) {
+  // Test describing a query already executed on the connection is answered
+  // from the metadata cache
+  Connect();
+
+  std::string sql = "select measure, time from mockDB.mockTable";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+  MockIoTSiteWiseService::GetInstance()->ResetRequestCount();
+
+  stmt->PrepareSqlQuery("select measure,  time\nfrom mockDB.mockTable");
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(stmt->GetColumnNumber(), 2);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetRequestCount(),
+                    0);
+
+  SQLULEN hits = 0;
+  dbc->GetAttribute(SQL_ATTR_SWMETADATA_CACHE_HITS, &hits, 0, nullptr);
+  BOOST_CHECK_EQUAL(hits, static_cast< SQLULEN >(1));
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryResultCache) {
+  // Test executing a query again is served from the query result cache
+  Configuration cfg;
+  cfg.SetResultCacheTTL(60);
+  Connect(cfg);
+  QueryResultCache::GetInstance().Clear();
+  MockIoTSiteWiseService::GetInstance()->ResetRequestCount();
+
+  std::string sql = "select measure, time from mockDB.mockTable3Pages";
+  for (int run = 0; run < 2; run++) {
+    stmt->ExecuteSqlQuery(sql);
+    BOOST_CHECK(IsSuccessful());
+
+    for (int i = 0; i < 9; i++) {
+      stmt->FetchRow();
+      BOOST_CHECK(IsSuccessful());
+    }
+    stmt->FetchRow();
+    BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+
+    stmt->Close();
+    BOOST_CHECK(IsSuccessful());
+  }
+
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetRequestCount(),
+                    3);
+
+  SQLULEN hits = 0;
+  dbc->GetAttribute(SQL_ATTR_SWRESULT_CACHE_HITS, &hits, 0, nullptr);
+  BOOST_CHECK_EQUAL(hits, static_cast< SQLULEN >(1));
+  SQLULEN misses = 0;
+  dbc->GetAttribute(SQL_ATTR_SWRESULT_CACHE_MISSES, &misses, 0, nullptr);
+  BOOST_CHECK_EQUAL(misses, static_cast< SQLULEN >(1));
+
+  // a result read partially is not cached
+  QueryResultCache::GetInstance().Clear();
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+  stmt->FetchRow();
+  BOOST_CHECK(IsSuccessful());
+  stmt->Close();
+  BOOST_CHECK_EQUAL(QueryResultCache::GetInstance().GetSize(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryCoalescing) {
+  // Test identical concurrent queries share one upstream page stream
+  Configuration cfg;
+  cfg.SetQueryCoalescing(true);
+  Connect(cfg);
+  MockIoTSiteWiseService::GetInstance()->ResetRequestCount();
+
+  std::string sql = "select measure, time from mockDB.mockTable3Pages";
+  iotsitewise::odbc::MockStatement* other = dbc->CreateStatement();
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+  other->ExecuteSqlQuery(sql);
+  BOOST_CHECK(other->GetDiagnosticRecords().IsSuccessful());
+
+  // each statement keeps its own cursor position
+  for (int i = 0; i < 9; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+  }
+  stmt->FetchRow();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+
+  for (int i = 0; i < 9; i++) {
+    other->FetchRow();
+    BOOST_CHECK(other->GetDiagnosticRecords().IsSuccessful());
+  }
+  other->FetchRow();
+  BOOST_CHECK_EQUAL(other->GetDiagnosticRecords().GetReturnCode(),
+                    SQL_NO_DATA);
+
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetRequestCount(),
+                    3);
+
+  // the finished stream is not joined, the query runs again
+  stmt->Close();
+  other->Close();
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+  for (int i = 0; i < 9; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+  }
+  stmt->FetchRow();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+  BOOST_CHECK_EQUAL(MockIoTSiteWiseService::GetInstance()->GetRequestCount(),
+                    6);
+  delete other;
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryTimeout) {
+  // Test the query timeout covers the page fetched in the background
+  Connect();
+
+  stmt->SetAttribute(SQL_ATTR_QUERY_TIMEOUT, reinterpret_cast< SQLPOINTER >(1),
+                     0);
+  BOOST_CHECK(IsSuccessful());
+
+  std::string sql = "select measure, time from mockDB.mockTableSlow";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  for (int i = 0; i < 3; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  stmt->FetchRow();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HYT00");
+  BOOST_CHECK(elapsed < std::chrono::seconds(5));
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryCloseAbortsFetch) {
+  // Test closing the cursor aborts the page request in flight
+  Connect();
+
+  std::string sql = "select measure, time from mockDB.mockTableSlow";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  stmt->FetchRow();
+  BOOST_CHECK(IsSuccessful());
+
+  auto start = std::chrono::steady_clock::now();
+  stmt->Close();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK(elapsed < std::chrono::seconds(1));
+}
+
 BOOST_AUTO_TEST_CASE(TestDataQuery10RowWithError) {
   // Test fetching 10 rows and each page contains 3 rows.
   // When fetch the 10th row, the outcome contains an error.
@@ -175,4 +517,332 @@ BOOST_AUTO_TEST_CASE(TestDataQuery10RowWithError) {
   BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
 }
 
+BOOST_AUTO_TEST_CASE(TestDataQueryRowArray) {
+  // Test fetching 9 rows of 3 pages with a row array of 4 rows
+  Connect();
+
+  const SQLULEN rowArraySize = 4;
+  stmt->SetAttribute(SQL_ATTR_ROW_ARRAY_SIZE,
+                     reinterpret_cast< SQLPOINTER >(rowArraySize), 0);
+  SQLULEN rowsFetched = 0;
+  stmt->SetAttribute(SQL_ATTR_ROWS_FETCHED_PTR, &rowsFetched, 0);
+  SQLUSMALLINT rowStatuses[rowArraySize];
+  stmt->SetAttribute(SQL_ATTR_ROW_STATUS_PTR, rowStatuses, 0);
+  BOOST_CHECK(IsSuccessful());
+
+  std::string sql = "select measure, time from mockDB.mockTable3Pages";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  SQLCHAR measure[rowArraySize][32];
+  SQLLEN measureLen[rowArraySize];
+  stmt->BindColumn(1, SQL_C_CHAR, measure, sizeof(measure[0]), measureLen);
+
+  SQL_TIMESTAMP_STRUCT timestamp[rowArraySize];
+  SQLLEN timestampLen[rowArraySize];
+  stmt->BindColumn(2, SQL_C_TYPE_TIMESTAMP, timestamp, sizeof(timestamp[0]),
+                   timestampLen);
+
+  // the rowsets span the pages
+  const SQLUSMALLINT days[] = {9, 10, 11, 9, 10, 11, 9, 10, 11};
+  int row = 0;
+  for (SQLULEN expected : {4, 4, 1}) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+    BOOST_REQUIRE_EQUAL(rowsFetched, expected);
+
+    for (SQLULEN i = 0; i < rowsFetched; i++, row++) {
+      BOOST_CHECK_EQUAL(rowStatuses[i], SQL_ROW_SUCCESS);
+      BOOST_CHECK_EQUAL(std::string(reinterpret_cast< char* >(measure[i])),
+                        "cpu_usage");
+      BOOST_CHECK_EQUAL(measureLen[i], 9);
+      BOOST_CHECK_EQUAL(timestamp[i].day, days[row]);
+      BOOST_CHECK_EQUAL(timestampLen[i],
+                        static_cast< SQLLEN >(sizeof(SQL_TIMESTAMP_STRUCT)));
+    }
+    for (SQLULEN i = rowsFetched; i < rowArraySize; i++) {
+      BOOST_CHECK_EQUAL(rowStatuses[i], SQL_ROW_NOROW);
+    }
+  }
+
+  stmt->FetchRow();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+  BOOST_CHECK_EQUAL(rowsFetched, 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryRowArrayTruncation) {
+  // Test a truncated value is reported for its row of the rowset
+  Connect();
+
+  const SQLULEN rowArraySize = 2;
+  stmt->SetAttribute(SQL_ATTR_ROW_ARRAY_SIZE,
+                     reinterpret_cast< SQLPOINTER >(rowArraySize), 0);
+  SQLUSMALLINT rowStatuses[rowArraySize];
+  stmt->SetAttribute(SQL_ATTR_ROW_STATUS_PTR, rowStatuses, 0);
+  BOOST_CHECK(IsSuccessful());
+
+  std::string sql = "select measure, time from mockDB.mockTable";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  SQLCHAR measure[rowArraySize][4];
+  SQLLEN measureLen[rowArraySize];
+  stmt->BindColumn(1, SQL_C_CHAR, measure, sizeof(measure[0]), measureLen);
+
+  stmt->FetchRow();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_SUCCESS_WITH_INFO);
+  BOOST_CHECK_EQUAL(GetSqlState(), "01004");
+  for (SQLULEN i = 0; i < rowArraySize; i++) {
+    BOOST_CHECK_EQUAL(rowStatuses[i], SQL_ROW_SUCCESS_WITH_INFO);
+    BOOST_CHECK_EQUAL(std::string(reinterpret_cast< char* >(measure[i])),
+                      "cpu");
+  }
+
+  const iotsitewise::odbc::diagnostic::DiagnosticRecordStorage& records =
+      stmt->GetDiagnosticRecords();
+  BOOST_REQUIRE_EQUAL(records.GetStatusRecordsNumber(), 2);
+  BOOST_CHECK_EQUAL(records.GetStatusRecord(1).GetRowNumber(), 1);
+  BOOST_CHECK_EQUAL(records.GetStatusRecord(2).GetRowNumber(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryRowArrayLargePages) {
+  // Test fetching 100000 rows of 10 pages with a row array of 3000 rows
+  Connect();
+
+  const SQLULEN rowArraySize = 3000;
+  stmt->SetAttribute(SQL_ATTR_ROW_ARRAY_SIZE,
+                     reinterpret_cast< SQLPOINTER >(rowArraySize), 0);
+  SQLULEN rowsFetched = 0;
+  stmt->SetAttribute(SQL_ATTR_ROWS_FETCHED_PTR, &rowsFetched, 0);
+  BOOST_CHECK(IsSuccessful());
+
+  std::string sql = "select value, time from mockDB.mockTableLargePages";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  std::vector< double > values(rowArraySize);
+  std::vector< SQLLEN > valueLen(rowArraySize);
+  stmt->BindColumn(1, SQL_C_DOUBLE, values.data(), sizeof(double),
+                   valueLen.data());
+
+  int total = 0;
+  for (;;) {
+    stmt->FetchRow();
+    if (GetReturnCode() == SQL_NO_DATA) {
+      break;
+    }
+    BOOST_REQUIRE(IsSuccessful());
+
+    for (SQLULEN i = 0; i < rowsFetched; i++, total++) {
+      BOOST_REQUIRE_EQUAL(values[i], total % 10000 + 0.5);
+      BOOST_REQUIRE_EQUAL(valueLen[i], static_cast< SQLLEN >(sizeof(double)));
+    }
+  }
+  BOOST_CHECK_EQUAL(total, 100000);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryRowWiseBinding) {
+  // Test fetching 9 rows of 3 pages into an array of row structures
+  Connect();
+
+  struct Row {
+    SQLCHAR measure[32];
+    SQLLEN measureLen;
+    SQL_TIMESTAMP_STRUCT time;
+    SQLLEN timeLen;
+  };
+
+  const SQLULEN rowArraySize = 4;
+  stmt->SetAttribute(SQL_ATTR_ROW_ARRAY_SIZE,
+                     reinterpret_cast< SQLPOINTER >(rowArraySize), 0);
+  stmt->SetAttribute(SQL_ATTR_ROW_BIND_TYPE,
+                     reinterpret_cast< SQLPOINTER >(sizeof(Row)), 0);
+  SQLULEN rowsFetched = 0;
+  stmt->SetAttribute(SQL_ATTR_ROWS_FETCHED_PTR, &rowsFetched, 0);
+  BOOST_CHECK(IsSuccessful());
+
+  std::string sql = "select measure, time from mockDB.mockTable3Pages";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  Row rows[rowArraySize];
+  stmt->BindColumn(1, SQL_C_CHAR, rows[0].measure, sizeof(rows[0].measure),
+                   &rows[0].measureLen);
+  stmt->BindColumn(2, SQL_C_TYPE_TIMESTAMP, &rows[0].time,
+                   sizeof(rows[0].time), &rows[0].timeLen);
+
+  // SQLFetch and SQLFetchScroll fill the rows the same way
+  const SQLUSMALLINT days[] = {9, 10, 11, 9, 10, 11, 9, 10, 11};
+  int row = 0;
+  bool scroll = false;
+  for (SQLULEN expected : {4, 4, 1}) {
+    memset(rows, 0, sizeof(rows));
+    if (scroll) {
+      stmt->FetchScroll(SQL_FETCH_NEXT, 0);
+    } else {
+      stmt->FetchRow();
+    }
+    scroll = !scroll;
+    BOOST_CHECK(IsSuccessful());
+    BOOST_REQUIRE_EQUAL(rowsFetched, expected);
+
+    for (SQLULEN i = 0; i < rowsFetched; i++, row++) {
+      BOOST_CHECK_EQUAL(
+          std::string(reinterpret_cast< char* >(rows[i].measure)),
+          "cpu_usage");
+      BOOST_CHECK_EQUAL(rows[i].measureLen, 9);
+      BOOST_CHECK_EQUAL(rows[i].time.day, days[row]);
+      BOOST_CHECK_EQUAL(rows[i].timeLen,
+                        static_cast< SQLLEN >(sizeof(SQL_TIMESTAMP_STRUCT)));
+    }
+  }
+
+  stmt->FetchRow();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+
+  SQLULEN rowBindType = 0;
+  stmt->GetAttribute(SQL_ATTR_ROW_BIND_TYPE, &rowBindType, 0, nullptr);
+  BOOST_CHECK_EQUAL(rowBindType, sizeof(Row));
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryRowWiseBindOffset) {
+  // Test filling consecutive parts of a row array with the bind offset
+  Connect();
+
+  struct Row {
+    double value;
+    SQLLEN valueLen;
+    SQL_TIMESTAMP_STRUCT time;
+    SQLLEN timeLen;
+  };
+
+  const SQLULEN rowArraySize = 3;
+  const SQLULEN fetches = 4;
+  stmt->SetAttribute(SQL_ATTR_ROW_ARRAY_SIZE,
+                     reinterpret_cast< SQLPOINTER >(rowArraySize), 0);
+  stmt->SetAttribute(SQL_ATTR_ROW_BIND_TYPE,
+                     reinterpret_cast< SQLPOINTER >(sizeof(Row)), 0);
+  SQLULEN bindOffset = 0;
+  stmt->SetAttribute(SQL_ATTR_ROW_BIND_OFFSET_PTR, &bindOffset, 0);
+  SQLULEN rowsFetched = 0;
+  stmt->SetAttribute(SQL_ATTR_ROWS_FETCHED_PTR, &rowsFetched, 0);
+  BOOST_CHECK(IsSuccessful());
+
+  std::string sql = "select value, time from mockDB.mockTableLargePages";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  Row rows[rowArraySize * fetches];
+  memset(rows, 0, sizeof(rows));
+  stmt->BindColumn(1, SQL_C_DOUBLE, &rows[0].value, sizeof(rows[0].value),
+                   &rows[0].valueLen);
+  stmt->BindColumn(2, SQL_C_TYPE_TIMESTAMP, &rows[0].time,
+                   sizeof(rows[0].time), &rows[0].timeLen);
+
+  for (SQLULEN i = 0; i < fetches; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+    BOOST_REQUIRE_EQUAL(rowsFetched, rowArraySize);
+    bindOffset += rowArraySize * sizeof(Row);
+  }
+
+  for (SQLULEN i = 0; i < rowArraySize * fetches; i++) {
+    BOOST_CHECK_EQUAL(rows[i].value, i + 0.5);
+    BOOST_CHECK_EQUAL(rows[i].valueLen,
+                      static_cast< SQLLEN >(sizeof(double)));
+    BOOST_CHECK_EQUAL(rows[i].timeLen,
+                      static_cast< SQLLEN >(sizeof(SQL_TIMESTAMP_STRUCT)));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryExtendedFetchBindOffset) {
+  // Test SQLExtendedFetch honors the bind offset of column-wise binding
+  Connect();
+
+  const SQLULEN rowsetSize = 4;
+  stmt->SetAttribute(SQL_ROWSET_SIZE,
+                     reinterpret_cast< SQLPOINTER >(rowsetSize), 0);
+  SQLULEN bindOffset = 0;
+  stmt->SetAttribute(SQL_ATTR_ROW_BIND_OFFSET_PTR, &bindOffset, 0);
+  BOOST_CHECK(IsSuccessful());
+
+  std::string sql = "select measure, time from mockDB.mockTable3Pages";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  // the second half of the arrays receives the rows
+  SQL_TIMESTAMP_STRUCT timestamp[rowsetSize * 2];
+  SQLLEN timestampLen[rowsetSize * 2];
+  memset(timestamp, 0, sizeof(timestamp));
+  memset(timestampLen, 0, sizeof(timestampLen));
+  stmt->BindColumn(2, SQL_C_TYPE_TIMESTAMP, timestamp, sizeof(timestamp[0]),
+                   timestampLen);
+  bindOffset = rowsetSize * sizeof(SQL_TIMESTAMP_STRUCT);
+
+  // the offset applies to the length array with the same byte count
+  SQLLEN* lenBase = reinterpret_cast< SQLLEN* >(
+      reinterpret_cast< char* >(timestampLen) + bindOffset);
+
+  SQLULEN rowCount = 0;
+  SQLUSMALLINT rowStatuses[rowsetSize];
+  stmt->ExtendedFetch(SQL_FETCH_NEXT, 0, &rowCount, rowStatuses);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_REQUIRE_EQUAL(rowCount, rowsetSize);
+
+  const SQLUSMALLINT days[] = {9, 10, 11, 9};
+  for (SQLULEN i = 0; i < rowsetSize; i++) {
+    BOOST_CHECK_EQUAL(rowStatuses[i], SQL_ROW_SUCCESS);
+    BOOST_CHECK_EQUAL(timestamp[i].day, 0);
+    BOOST_CHECK_EQUAL(timestamp[rowsetSize + i].day, days[i]);
+    BOOST_CHECK_EQUAL(lenBase[i],
+                      static_cast< SQLLEN >(sizeof(SQL_TIMESTAMP_STRUCT)));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryRowArrayRepetative, *disabled()) {
+  // Compare fetching 100000 rows with row arrays of 1, 100 and 10000 rows
+  Connect();
+
+  for (SQLULEN rowArraySize : {1, 100, 10000}) {
+    stmt->SetAttribute(SQL_ATTR_ROW_ARRAY_SIZE,
+                       reinterpret_cast< SQLPOINTER >(rowArraySize), 0);
+    SQLULEN rowsFetched = 0;
+    stmt->SetAttribute(SQL_ATTR_ROWS_FETCHED_PTR, &rowsFetched, 0);
+
+    std::string sql = "select value, time from mockDB.mockTableLargePages";
+    stmt->ExecuteSqlQuery(sql);
+    BOOST_CHECK(IsSuccessful());
+
+    std::vector< double > values(rowArraySize);
+    std::vector< SQLLEN > valueLen(rowArraySize);
+    std::vector< SQL_TIMESTAMP_STRUCT > timestamps(rowArraySize);
+    std::vector< SQLLEN > timestampLen(rowArraySize);
+    stmt->BindColumn(1, SQL_C_DOUBLE, values.data(), sizeof(double),
+                     valueLen.data());
+    stmt->BindColumn(2, SQL_C_TYPE_TIMESTAMP, timestamps.data(),
+                     sizeof(SQL_TIMESTAMP_STRUCT), timestampLen.data());
+
+    SQLULEN total = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (;;) {
+      stmt->FetchRow();
+      if (GetReturnCode() == SQL_NO_DATA) {
+        break;
+      }
+      total += rowsFetched;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    BOOST_CHECK_EQUAL(total, static_cast< SQLULEN >(100000));
+
+    std::cout << "Row array size " << rowArraySize << ": "
+              << std::chrono::duration_cast< std::chrono::microseconds >(
+                     end - start)
+                     .count()
+              << " microseconds\n";
+
+    stmt->Close();
+    stmt->SetAttribute(SQL_ATTR_ROWS_FETCHED_PTR, nullptr, 0);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -23,6 +23,12 @@
 
 #include <boost/test/unit_test.hpp>
 #include <chrono>
+#include <cmath>
+#include <codecvt>
+#include <cstring>
+#include <ctime>
+#include <limits>
+#include <locale>
 #include <stdio.h>
 
 using namespace iotsitewise::odbc;
@@ -137,6 +143,122 @@ BOOST_AUTO_TEST_CASE(TestUtilityCopyStringToBufferRepetative, *disabled()) {
             << " nanoseconds\n";
 }
 
+BOOST_AUTO_TEST_CASE(TestUtilityTranscodeUtf8ToSqlWchar) {
+  SQLWCHAR buffer[64];
+  size_t bytesRead = 0;
+  size_t bytesWritten = 0;
+  const size_t wCharSize = sizeof(SQLWCHAR);
+
+  // ASCII longer than a word, with a tail
+  std::string ascii("Some data. And some more data here.");
+  size_t bytesRequired = TranscodeUtf8ToSqlWchar(
+      ascii.data(), ascii.size(), buffer, sizeof(buffer), bytesRead,
+      bytesWritten);
+  BOOST_CHECK_EQUAL(ascii.size() * wCharSize, bytesRequired);
+  BOOST_CHECK_EQUAL(ascii.size() * wCharSize, bytesWritten);
+  BOOST_CHECK_EQUAL(ascii.size(), bytesRead);
+  BOOST_CHECK_EQUAL(SqlWcharToString(buffer), ascii);
+
+  // 2, 3 and 4 byte characters, the last one needs 2 SQLWCHAR in UTF-16
+  std::string multibyte = u8"abé你\U0001F600c";
+  size_t units = wCharSize == 2 ? 7 : 6;
+  bytesRequired =
+      TranscodeUtf8ToSqlWchar(multibyte.data(), multibyte.size(), buffer,
+                              sizeof(buffer), bytesRead, bytesWritten);
+  BOOST_CHECK_EQUAL(units * wCharSize, bytesRequired);
+  BOOST_CHECK_EQUAL(units * wCharSize, bytesWritten);
+  BOOST_CHECK_EQUAL(multibyte.size(), bytesRead);
+  BOOST_CHECK_EQUAL(SqlWcharToString(buffer), multibyte);
+
+  // A character is not split, the length of the whole string is reported.
+  // One SQLWCHAR is left for the last character but one, which needs 2 in
+  // UTF-16.
+  bytesRequired = TranscodeUtf8ToSqlWchar(
+      multibyte.data(), multibyte.size(), buffer, (units - 2 + 1) * wCharSize,
+      bytesRead, bytesWritten);
+  BOOST_CHECK_EQUAL(units * wCharSize, bytesRequired);
+  BOOST_CHECK_EQUAL(SqlWcharToString(buffer), u8"abé你");
+  BOOST_CHECK_EQUAL(strlen(u8"abé你"), bytesRead);
+  BOOST_CHECK_EQUAL(4 * wCharSize, bytesWritten);
+
+  // Length only
+  bytesRequired = TranscodeUtf8ToSqlWchar(multibyte.data(), multibyte.size(),
+                                          nullptr, 0, bytesRead, bytesWritten);
+  BOOST_CHECK_EQUAL(units * wCharSize, bytesRequired);
+  BOOST_CHECK_EQUAL(0, bytesRead);
+  BOOST_CHECK_EQUAL(0, bytesWritten);
+
+  // Invalid bytes are replaced
+  std::string invalid("a\xC0" "b\xED\xA0\x80" "c\xE2\x82");
+  bytesRequired =
+      TranscodeUtf8ToSqlWchar(invalid.data(), invalid.size(), buffer,
+                              sizeof(buffer), bytesRead, bytesWritten);
+  const SQLWCHAR expected[] = {'a', 0xFFFD, 'b', 0xFFFD, 0xFFFD, 0xFFFD,
+                               'c', 0xFFFD, 0xFFFD};
+  BOOST_REQUIRE_EQUAL(sizeof(expected), bytesWritten);
+  BOOST_CHECK_EQUAL(sizeof(expected), bytesRequired);
+  BOOST_CHECK(memcmp(expected, buffer, sizeof(expected)) == 0);
+
+  BOOST_CHECK_EQUAL(6, CountUtf8Chars(multibyte.data(), multibyte.size()));
+  BOOST_CHECK_EQUAL(ascii.size(), CountUtf8Chars(ascii.data(), ascii.size()));
+}
+
+// Enable test to determine efficiency of conversion function.
+BOOST_AUTO_TEST_CASE(TestUtilityTranscodeUtf8ToSqlWcharRepetative,
+                     *disabled()) {
+  const char* multibyteChars[] = {u8"é", u8"你"};
+  int strLen = 1024 * 1024;
+  std::string ascii;
+  std::string multibyte;
+  for (int i = 0; i < strLen; i++) {
+    ascii.push_back('a' + rand() % 26);
+    if (i % 4 == 0) {
+      multibyte += multibyteChars[rand() % 2];
+    } else {
+      multibyte.push_back('a' + rand() % 26);
+    }
+  }
+  std::vector< SQLWCHAR > buffer(multibyte.size() + 1);
+  size_t bufferLenBytes = buffer.size() * sizeof(SQLWCHAR);
+
+  for (const std::string* str : {&ascii, &multibyte}) {
+    // Length and copy in two passes, as before
+    auto t1 = std::chrono::high_resolution_clock::now();
+    size_t twoPassBytes = 0;
+    bool isTruncated = false;
+    for (int i = 0; i < 100; i++) {
+      std::wstring_convert< std::codecvt_utf8< wchar_t >, wchar_t > converter;
+      twoPassBytes = converter.from_bytes(*str).size();
+      CopyUtf8StringToSqlWcharString(str->c_str(), buffer.data(),
+                                     bufferLenBytes, isTruncated);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+
+    size_t bytesRequired = 0;
+    size_t bytesRead = 0;
+    size_t bytesWritten = 0;
+    for (int i = 0; i < 100; i++) {
+      bytesRequired =
+          TranscodeUtf8ToSqlWchar(str->data(), str->size(), buffer.data(),
+                                  bufferLenBytes, bytesRead, bytesWritten);
+    }
+    auto t3 = std::chrono::high_resolution_clock::now();
+
+    BOOST_CHECK_EQUAL(str->size(), bytesRead);
+    BOOST_CHECK(twoPassBytes > 0);
+    std::cout << (str == &ascii ? "ASCII" : "multibyte") << ", "
+              << bytesRequired << " bytes, two passes: "
+              << std::chrono::duration_cast< std::chrono::nanoseconds >(t2
+                                                                        - t1)
+                     .count()
+              << " nanoseconds, single pass: "
+              << std::chrono::duration_cast< std::chrono::nanoseconds >(t3
+                                                                        - t2)
+                     .count()
+              << " nanoseconds\n";
+  }
+}
+
 BOOST_AUTO_TEST_CASE(TestUtilitySqlStringToString) {
   std::string utf8String = u8"你好 - Some data. And some more data here.";
   std::vector< SQLWCHAR > buffer = ToWCHARVector(utf8String);
@@ -174,4 +296,233 @@ BOOST_AUTO_TEST_CASE(TestUtilitySqlStringToString) {
   BOOST_CHECK_EQUAL(utf8StringShortened, result);
 }
 
+namespace {
+bool ParseUtcTimestamp(const std::string& str, int64_t& seconds,
+                       int32_t& fractionNs) {
+  return utility::ParseUtcTimestamp(str.c_str(), str.size(), seconds,
+                                    fractionNs);
+}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(TestUtilityParseUtcTimestamp) {
+  int64_t seconds = 0;
+  int32_t fractionNs = 0;
+
+  BOOST_REQUIRE(ParseUtcTimestamp("2022-11-09 23:52:51.554000000", seconds,
+                                  fractionNs));
+  BOOST_CHECK_EQUAL(seconds, 1668037971);
+  BOOST_CHECK_EQUAL(fractionNs, 554000000);
+
+  BOOST_REQUIRE(
+      ParseUtcTimestamp("1970-01-01 00:00:00", seconds, fractionNs));
+  BOOST_CHECK_EQUAL(seconds, 0);
+  BOOST_CHECK_EQUAL(fractionNs, 0);
+
+  // before the epoch
+  BOOST_REQUIRE(
+      ParseUtcTimestamp("1969-12-31 23:59:59.5", seconds, fractionNs));
+  BOOST_CHECK_EQUAL(seconds, -1);
+  BOOST_CHECK_EQUAL(fractionNs, 500000000);
+
+  BOOST_REQUIRE(
+      ParseUtcTimestamp("1900-01-01 00:00:00", seconds, fractionNs));
+  BOOST_CHECK_EQUAL(seconds, -2208988800LL);
+
+  // leap years
+  BOOST_REQUIRE(
+      ParseUtcTimestamp("2020-02-29 00:00:00.000001", seconds, fractionNs));
+  BOOST_CHECK_EQUAL(seconds, 1582934400);
+  BOOST_CHECK_EQUAL(fractionNs, 1000);
+
+  BOOST_REQUIRE(
+      ParseUtcTimestamp("2000-03-01 00:00:00", seconds, fractionNs));
+  BOOST_CHECK_EQUAL(seconds, 951868800);
+
+  // 2100 is not a leap year
+  BOOST_REQUIRE(
+      ParseUtcTimestamp("2100-03-01 00:00:00", seconds, fractionNs));
+  BOOST_CHECK_EQUAL(seconds, 4107542400LL);
+
+  BOOST_REQUIRE(
+      ParseUtcTimestamp("2021-02-28 12:30:45.123", seconds, fractionNs));
+  BOOST_CHECK_EQUAL(seconds, 1614515445);
+  BOOST_CHECK_EQUAL(fractionNs, 123000000);
+
+  BOOST_CHECK(!ParseUtcTimestamp("", seconds, fractionNs));
+  BOOST_CHECK(!ParseUtcTimestamp("2022-11-09T23:52:51", seconds, fractionNs));
+  BOOST_CHECK(!ParseUtcTimestamp("2022-13-09 23:52:51", seconds, fractionNs));
+  BOOST_CHECK(!ParseUtcTimestamp("2022-11-09 24:00:00", seconds, fractionNs));
+  BOOST_CHECK(!ParseUtcTimestamp("2022-11-9 23:52:51", seconds, fractionNs));
+  BOOST_CHECK(!ParseUtcTimestamp("2022-11-09 23:52:51.", seconds, fractionNs));
+  BOOST_CHECK(!ParseUtcTimestamp("2022-11-09 23:52:51.5x", seconds,
+                                 fractionNs));
+  BOOST_CHECK(!ParseUtcTimestamp("2022-11-09 23:52:51.5540000001", seconds,
+                                 fractionNs));
+}
+
+// Enable test to compare the timestamp parsing with sscanf and timegm.
+BOOST_AUTO_TEST_CASE(TestUtilityParseUtcTimestampRepetative, *disabled()) {
+  const int count = 1000000;
+  std::vector< std::string > values;
+  values.reserve(count);
+  for (int i = 0; i < count; i++) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "20%02d-%02d-%02d %02d:%02d:%02d.%09d",
+             rand() % 100, rand() % 12 + 1, rand() % 28 + 1, rand() % 24,
+             rand() % 60, rand() % 60, rand() % 1000000000);
+    values.push_back(buf);
+  }
+
+  int64_t sum = 0;
+  auto t1 = std::chrono::high_resolution_clock::now();
+  for (const std::string& value : values) {
+    tm tmTime;
+    memset(&tmTime, 0, sizeof(tm));
+    int32_t fractionNs = 0;
+    sscanf(value.c_str(), "%4d-%2d-%2d %2d:%2d:%2d.%9d", &tmTime.tm_year,
+           &tmTime.tm_mon, &tmTime.tm_mday, &tmTime.tm_hour, &tmTime.tm_min,
+           &tmTime.tm_sec, &fractionNs);
+    tmTime.tm_year -= 1900;
+    tmTime.tm_mon--;
+#ifdef _WIN32
+    sum += _mkgmtime(&tmTime);
+#else
+    sum += timegm(&tmTime);
+#endif
+  }
+  auto t2 = std::chrono::high_resolution_clock::now();
+
+  int64_t parsedSum = 0;
+  for (const std::string& value : values) {
+    int64_t seconds = 0;
+    int32_t fractionNs = 0;
+    ParseUtcTimestamp(value, seconds, fractionNs);
+    parsedSum += seconds;
+  }
+  auto t3 = std::chrono::high_resolution_clock::now();
+
+  BOOST_CHECK_EQUAL(sum, parsedSum);
+  std::cout << "sscanf and timegm: "
+            << std::chrono::duration_cast< std::chrono::nanoseconds >(t2 - t1)
+                   .count()
+            << " nanoseconds\n";
+  std::cout << "ParseUtcTimestamp: "
+            << std::chrono::duration_cast< std::chrono::nanoseconds >(t3 - t2)
+                   .count()
+            << " nanoseconds\n";
+}
+
+namespace {
+bool ParseDouble(const std::string& str, double& value) {
+  return utility::ParseDouble(str.c_str(), str.size(), value);
+}
+
+bool ParseInt32(const std::string& str, int32_t& value) {
+  return utility::ParseInt32(str.c_str(), str.size(), value);
+}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(TestUtilityParseDouble) {
+  double value = 0.0;
+
+  BOOST_REQUIRE(ParseDouble("35.5", value));
+  BOOST_CHECK_EQUAL(value, 35.5);
+  BOOST_REQUIRE(ParseDouble("-0.001", value));
+  BOOST_CHECK_EQUAL(value, -0.001);
+  BOOST_REQUIRE(ParseDouble("+12", value));
+  BOOST_CHECK_EQUAL(value, 12.0);
+  BOOST_REQUIRE(ParseDouble(".5", value));
+  BOOST_CHECK_EQUAL(value, 0.5);
+  BOOST_REQUIRE(ParseDouble("1.5E3", value));
+  BOOST_CHECK_EQUAL(value, 1500.0);
+  BOOST_REQUIRE(ParseDouble("1.7976931348623157e308", value));
+  BOOST_CHECK_EQUAL(value, std::numeric_limits< double >::max());
+  BOOST_REQUIRE(ParseDouble("4.9406564584124654e-324", value));
+  BOOST_CHECK_EQUAL(value, std::numeric_limits< double >::denorm_min());
+  BOOST_REQUIRE(ParseDouble("123456789012345678901234567890", value));
+  BOOST_CHECK_EQUAL(value, 1.2345678901234568e29);
+
+  // every double is read back exactly from its shortest exact form
+  for (int i = 0; i < 10000; i++) {
+    uint64_t bits = (static_cast< uint64_t >(rand()) << 48)
+                    ^ (static_cast< uint64_t >(rand()) << 24)
+                    ^ static_cast< uint64_t >(rand());
+    double expected;
+    memcpy(&expected, &bits, sizeof(expected));
+    if (std::isnan(expected) || std::isinf(expected)) {
+      continue;
+    }
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.17g", expected);
+    BOOST_REQUIRE(ParseDouble(buf, value));
+    BOOST_CHECK_EQUAL(value, expected);
+  }
+
+  BOOST_CHECK(!ParseDouble("", value));
+  BOOST_CHECK(!ParseDouble("abc", value));
+  BOOST_CHECK(!ParseDouble("1,5", value));
+  BOOST_CHECK(!ParseDouble("12abc", value));
+  BOOST_CHECK(!ParseDouble(" 12", value));
+  BOOST_CHECK(!ParseDouble("1e", value));
+  BOOST_CHECK(!ParseDouble("1e400", value));
+}
+
+BOOST_AUTO_TEST_CASE(TestUtilityParseInt32) {
+  int32_t value = 0;
+
+  BOOST_REQUIRE(ParseInt32("42", value));
+  BOOST_CHECK_EQUAL(value, 42);
+  BOOST_REQUIRE(ParseInt32("-12", value));
+  BOOST_CHECK_EQUAL(value, -12);
+  BOOST_REQUIRE(ParseInt32("2147483647", value));
+  BOOST_CHECK_EQUAL(value, INT32_MAX);
+  BOOST_REQUIRE(ParseInt32("-2147483648", value));
+  BOOST_CHECK_EQUAL(value, INT32_MIN);
+
+  BOOST_CHECK(!ParseInt32("", value));
+  BOOST_CHECK(!ParseInt32("-", value));
+  BOOST_CHECK(!ParseInt32("2147483648", value));
+  BOOST_CHECK(!ParseInt32("99999999999", value));
+  BOOST_CHECK(!ParseInt32("1.5", value));
+  BOOST_CHECK(!ParseInt32("12abc", value));
+}
+
+// Enable test to compare the number parsing with std::stod.
+BOOST_AUTO_TEST_CASE(TestUtilityParseDoubleRepetative, *disabled()) {
+  const int count = 1000000;
+  std::vector< std::string > values;
+  values.reserve(count);
+  for (int i = 0; i < count; i++) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", rand() % 7,
+             (rand() - RAND_MAX / 2) / 100.0);
+    values.push_back(buf);
+  }
+
+  double sum = 0.0;
+  auto t1 = std::chrono::high_resolution_clock::now();
+  for (const std::string& value : values) {
+    sum += std::stod(value);
+  }
+  auto t2 = std::chrono::high_resolution_clock::now();
+
+  double parsedSum = 0.0;
+  for (const std::string& value : values) {
+    double number = 0.0;
+    ParseDouble(value, number);
+    parsedSum += number;
+  }
+  auto t3 = std::chrono::high_resolution_clock::now();
+
+  BOOST_CHECK_EQUAL(sum, parsedSum);
+  std::cout << "std::stod: "
+            << std::chrono::duration_cast< std::chrono::nanoseconds >(t2 - t1)
+                   .count()
+            << " nanoseconds\n";
+  std::cout << "ParseDouble: "
+            << std::chrono::duration_cast< std::chrono::nanoseconds >(t3 - t2)
+                   .count()
+            << " nanoseconds\n";
+}
+
 BOOST_AUTO_TEST_SUITE_END()